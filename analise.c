@@ -0,0 +1,335 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file analise.c
+ * @author Thiago Abreu
+ * @brief Implementação dos indicadores da rede.
+ *
+ * Dupla varredura: a partir de um vértice qualquer da componente, o mais
+ * afastado `u` está num extremo de um caminho longo; a excentricidade de `u`
+ * é um limite inferior do diâmetro, exato em árvores e muito próximo em grafos
+ * de grelha.
+ *
+ * As centralidades seguem Brandes: cada origem amostrada faz uma procura em
+ * largura que conta os caminhos mais curtos (sigma) e, pela ordem inversa de
+ * visita, acumula as dependências. Com k origens de n, os valores são
+ * multiplicados por n / k. Custo total O(k (V + E)) em vez de O(V (V + E)).
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "analise.h"
+#include "gerador.h"
+
+/**
+ * @struct EspacoProcura
+ * @brief Vetores reutilizados entre procuras em largura.
+ */
+
+typedef struct EspacoProcura {
+    int *distancia;      /**< Distância à origem (-1 se não visitado) */
+    int *ordem;          /**< Vértices pela ordem de visita (também serve de fila) */
+    double *caminhos;    /**< Número de caminhos mais curtos desde a origem */
+    double *dependencia; /**< Dependência acumulada de cada vértice */
+} EspacoProcura;
+
+/**
+ * @brief Procura em largura a partir de uma origem, registando distâncias e ordem de visita.
+ *
+ * Só os vértices visitados ficam com distância >= 0; no fim, o chamador repõe
+ * -1 nesses vértices (percorrendo `ordem`), sem limpar o vetor inteiro.
+ *
+ * @param g Grafo compacto.
+ * @param e Espaço de trabalho (distancia a -1 em todos os vértices à entrada).
+ * @param origem Vértice de origem.
+ * @param contarCaminhos true para preencher também `caminhos`.
+ * @return Número de vértices visitados.
+ */
+
+static int larguraVetores(const GrafoCSR *g, EspacoProcura *e, int origem, bool contarCaminhos) {
+
+    int inicio = 0, fim = 0;
+    e -> ordem[fim++] = origem;
+    e -> distancia[origem] = 0;
+    if (contarCaminhos) e -> caminhos[origem] = 1.0;
+
+    while (inicio < fim) {
+
+        int v = e -> ordem[inicio++];
+
+        for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+
+            int w = g -> destinos[k];
+
+            if (e -> distancia[w] < 0) {
+                e -> distancia[w] = e -> distancia[v] + 1;
+                e -> ordem[fim++] = w;
+                if (contarCaminhos) e -> caminhos[w] = 0.0;
+            }
+            if (contarCaminhos && e -> distancia[w] == e -> distancia[v] + 1) {
+                e -> caminhos[w] += e -> caminhos[v];
+            }
+
+        }
+
+    }
+
+    return fim;
+
+}
+
+/**
+ * @brief Repõe a distância -1 nos vértices visitados pela última procura.
+ *
+ * @param e Espaço de trabalho.
+ * @param visitados Número de vértices visitados.
+ */
+
+static void limparProcura(EspacoProcura *e, int visitados) {
+
+    for (int i = 0; i < visitados; i++) {
+        e -> distancia[e -> ordem[i]] = -1;
+    }
+
+}
+
+/**
+ * @brief Calcula os indicadores do grafo.
+ *
+ * @param g Grafo compacto (as ligações são tratadas como não dirigidas).
+ * @param amostras Número de origens para as centralidades (limitado a numVertices;
+ *                 com amostras >= numVertices o resultado é exato).
+ * @param semente Semente da escolha das origens.
+ * @return Indicadores calculados, ou false em caso de falha de memória.
+ */
+
+AnaliseGrafo *analisarGrafo(const GrafoCSR *g, int amostras, unsigned int semente) {
+
+    if (!g) {
+        return false;
+    }
+
+    AnaliseGrafo *a = (AnaliseGrafo *)calloc(1, sizeof(AnaliseGrafo));
+    if (!a) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    int m = n > 0 ? n : 1;
+    a -> numVertices = n;
+    a -> amostras = amostras < 0 ? 0 : (amostras > n ? n : amostras);
+
+    a -> componente = (int *)malloc(m * sizeof(int));
+    a -> proximidade = (double *)calloc(m, sizeof(double));
+    a -> intermediacao = (double *)calloc(m, sizeof(double));
+
+    EspacoProcura e;
+    e.distancia = (int *)malloc(m * sizeof(int));
+    e.ordem = (int *)malloc(m * sizeof(int));
+    e.caminhos = (double *)malloc(m * sizeof(double));
+    e.dependencia = (double *)malloc(m * sizeof(double));
+    int *origens = (int *)malloc(m * sizeof(int));
+    int *contagemAmostras = (int *)calloc(m, sizeof(int));
+    long long *somaDistancias = (long long *)calloc(m, sizeof(long long));
+
+    bool memoria = a -> componente && a -> proximidade && a -> intermediacao && e.distancia && e.ordem &&
+                   e.caminhos && e.dependencia && origens && contagemAmostras && somaDistancias;
+
+    if (memoria) {
+
+        for (int v = 0; v < n; v++) {
+            a -> componente[v] = -1;
+            e.distancia[v] = -1;
+        }
+
+        // Componentes e graus
+        for (int v = 0; v < n; v++) {
+            int grau = g -> inicioArestas[v + 1] - g -> inicioArestas[v];
+            if (grau > a -> grauMaximo) a -> grauMaximo = grau;
+            if (a -> componente[v] >= 0) continue;
+            int visitados = larguraVetores(g, &e, v, false);
+            for (int i = 0; i < visitados; i++) a -> componente[e.ordem[i]] = a -> numComponentes;
+            limparProcura(&e, visitados);
+            a -> numComponentes++;
+        }
+
+        int c = a -> numComponentes > 0 ? a -> numComponentes : 1;
+        a -> tamanhoComponente = (int *)calloc(c, sizeof(int));
+        a -> diametroComponente = (int *)calloc(c, sizeof(int));
+        a -> histogramaGrau = (long *)calloc(a -> grauMaximo + 1, sizeof(long));
+        memoria = a -> tamanhoComponente && a -> diametroComponente && a -> histogramaGrau;
+
+    }
+
+    if (memoria) {
+
+        for (int v = 0; v < n; v++) {
+            a -> tamanhoComponente[a -> componente[v]]++;
+            a -> histogramaGrau[g -> inicioArestas[v + 1] - g -> inicioArestas[v]]++;
+        }
+
+        int maior = 0;
+        for (int k = 0; k < a -> numComponentes; k++) {
+            if (a -> tamanhoComponente[k] > maior) maior = a -> tamanhoComponente[k];
+        }
+        while ((1 << a -> classesComponentes) <= maior && a -> classesComponentes < 31) a -> classesComponentes++;
+        a -> histogramaComponentes = (long *)calloc(a -> classesComponentes > 0 ? a -> classesComponentes : 1, sizeof(long));
+        memoria = a -> histogramaComponentes != NULL;
+
+    }
+
+    if (memoria) {
+
+        for (int k = 0; k < a -> numComponentes; k++) {
+            int classe = 0;
+            while ((2 << classe) <= a -> tamanhoComponente[k]) classe++;
+            a -> histogramaComponentes[classe]++;
+        }
+
+        // Dupla varredura a partir do primeiro vértice de cada componente
+        int proxima = 0;
+        for (int v = 0; v < n; v++) {
+
+            if (a -> componente[v] != proxima) continue;
+            proxima++;
+
+            int visitados = larguraVetores(g, &e, v, false);
+            int extremo = e.ordem[visitados - 1];
+            limparProcura(&e, visitados);
+
+            visitados = larguraVetores(g, &e, extremo, false);
+            a -> diametroComponente[a -> componente[v]] = e.distancia[e.ordem[visitados - 1]];
+            limparProcura(&e, visitados);
+
+        }
+
+        // Origens amostradas sem repetição (Fisher-Yates parcial)
+        uint64_t estado = ((uint64_t)semente << 1) | 1;
+        for (int v = 0; v < n; v++) origens[v] = v;
+        for (int i = 0; i < a -> amostras; i++) {
+            int j = i + (int)(proximoAleatorio(&estado) % (uint64_t)(n - i));
+            int t = origens[i];
+            origens[i] = origens[j];
+            origens[j] = t;
+        }
+
+        for (int i = 0; i < a -> amostras; i++) {
+
+            int s = origens[i];
+            int visitados = larguraVetores(g, &e, s, true);
+
+            for (int j = 0; j < visitados; j++) {
+                int w = e.ordem[j];
+                e.dependencia[w] = 0.0;
+                if (w != s) {
+                    somaDistancias[w] += e.distancia[w];
+                    contagemAmostras[w]++;
+                }
+            }
+
+            // Acumulação das dependências pela ordem inversa de visita
+            for (int j = visitados - 1; j > 0; j--) {
+                int w = e.ordem[j];
+                for (int k = g -> inicioArestas[w]; k < g -> inicioArestas[w + 1]; k++) {
+                    int v = g -> destinos[k];
+                    if (e.distancia[v] == e.distancia[w] - 1) {
+                        e.dependencia[v] += e.caminhos[v] / e.caminhos[w] * (1.0 + e.dependencia[w]);
+                    }
+                }
+                a -> intermediacao[w] += e.dependencia[w];
+            }
+
+            limparProcura(&e, visitados);
+
+        }
+
+        double escala = a -> amostras > 0 ? (double)n / a -> amostras : 0.0;
+        for (int v = 0; v < n; v++) {
+            a -> intermediacao[v] *= escala;
+            a -> proximidade[v] = somaDistancias[v] > 0 ? (double)contagemAmostras[v] / somaDistancias[v] : 0.0;
+        }
+
+    }
+
+    free(e.distancia);
+    free(e.ordem);
+    free(e.caminhos);
+    free(e.dependencia);
+    free(origens);
+    free(contagemAmostras);
+    free(somaDistancias);
+
+    if (!memoria) {
+        return libertarAnaliseGrafo(a);
+    }
+
+    return a;
+
+}
+
+/**
+ * @brief Obtém os k vértices de maior intermediação estimada.
+ *
+ * @param a Indicadores do grafo.
+ * @param k Número de vértices pedidos.
+ * @param resultado Vetor com espaço para k índices CSR, por intermediação decrescente.
+ * @return Número de vértices devolvidos (até k).
+ */
+
+int verticesCentrais(const AnaliseGrafo *a, int k, int *resultado) {
+
+    if (!a || k <= 0) {
+        return 0;
+    }
+
+    // Inserção ordenada nos k melhores; em empate, fica o de menor índice
+    int n = 0;
+    for (int v = 0; v < a -> numVertices; v++) {
+
+        double valor = a -> intermediacao[v];
+        if (n == k && valor <= a -> intermediacao[resultado[n - 1]]) continue;
+
+        int i = n < k ? n++ : n - 1;
+        while (i > 0 && a -> intermediacao[resultado[i - 1]] < valor) {
+            resultado[i] = resultado[i - 1];
+            i--;
+        }
+        resultado[i] = v;
+
+    }
+
+    return n;
+
+}
+
+/**
+ * @brief Liberta os indicadores do grafo.
+ *
+ * @param a Indicadores.
+ * @return false após a libertação.
+ */
+
+AnaliseGrafo *libertarAnaliseGrafo(AnaliseGrafo *a) {
+
+    if (!a) {
+        return false;
+    }
+
+    free(a -> componente);
+    free(a -> tamanhoComponente);
+    free(a -> diametroComponente);
+    free(a -> proximidade);
+    free(a -> intermediacao);
+    free(a -> histogramaGrau);
+    free(a -> histogramaComponentes);
+    free(a);
+
+    return false;
+
+}
@@ -0,0 +1,52 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file analise.h
+ * @author Thiago Abreu
+ * @brief Indicadores da rede de antenas: diâmetro, centralidade e distribuições.
+ *
+ * Trabalha sobre o grafo compacto (CSR), com distâncias e filas em vetores. O
+ * diâmetro de cada componente é estimado por dupla varredura (duas procuras em
+ * largura) e a proximidade e a intermediação por procuras a partir de uma amostra
+ * de origens, em vez de uma procura por vértice.
+ */
+
+#ifndef ANALISE_H
+#define ANALISE_H
+
+#include "grafocsr.h"
+
+/** Número de origens amostradas por omissão para as centralidades. */
+#define AMOSTRAS_ANALISE_PADRAO 64
+
+/**
+ * @struct AnaliseGrafo
+ * @brief Indicadores calculados para um grafo compacto.
+ */
+
+typedef struct AnaliseGrafo {
+    int numVertices;             /**< Vértices do grafo */
+    int numComponentes;          /**< Componentes ligadas */
+    int *componente;             /**< Componente de cada vértice */
+    int *tamanhoComponente;      /**< Vértices de cada componente */
+    int *diametroComponente;     /**< Diâmetro estimado (limite inferior, em saltos) de cada componente */
+    int amostras;                /**< Origens usadas nas centralidades */
+    double *proximidade;         /**< Proximidade estimada: inverso da distância média aos vértices da componente */
+    double *intermediacao;       /**< Intermediação estimada, sobre pares ordenados (origem, destino), escalada para n origens */
+    int grauMaximo;              /**< Maior grau */
+    long *histogramaGrau;        /**< Vértices com cada grau (grauMaximo + 1 entradas) */
+    int classesComponentes;      /**< Entradas de `histogramaComponentes` */
+    long *histogramaComponentes; /**< Componentes com tamanho em [2^k, 2^(k+1)) */
+} AnaliseGrafo;
+
+AnaliseGrafo *analisarGrafo(const GrafoCSR *g, int amostras, unsigned int semente);
+int verticesCentrais(const AnaliseGrafo *a, int k, int *resultado);
+AnaliseGrafo *libertarAnaliseGrafo(AnaliseGrafo *a);
+
+#endif
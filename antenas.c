@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "antenas.h"
+#include "instrumentacao.h"
 
 /**
  * @brief Insere uma nova antena na lista ligada em ordem crescente (x, depois y).
@@ -26,18 +27,23 @@
  * para um novo nó e insere-o mantendo a ordem da lista baseada nas coordenadas.
  *
  * @param lista Apontador para o início da lista ligada de antenas.
- * @param frequencia Caractere que representa a frequência da antena.
+ * @param frequencia Identificador da frequência (FREQUENCIA_QUALQUER é recusado).
  * @param x Posição X da antena.
  * @param y Posição Y da antena.
  * @return Novo apontador para o novo início da lista, ou NULL em caso de erro ou duplicada.
  */
 
-Antena *inserirAntena(Antena *lista, char frequencia, int x, int y) {
+Antena *inserirAntena(Antena *lista, Frequencia frequencia, int x, int y) {
+
+    if (frequencia == FREQUENCIA_QUALQUER) {
+        return false;
+    }
 
     // Verifica se já existe uma antena na posição (x,y)
     Antena *verifica = lista;
     while (verifica) {
 
+        INSTR_CONTAR(CONTADOR_NOS_INSERIR_ANTENA, 1);
         if (verifica -> x == x && verifica->y == y) {
             // Erro, Ja existe uma antena na posicao
             return false; // Mantém a lista sem alterações
@@ -52,6 +58,7 @@ Antena *inserirAntena(Antena *lista, char frequencia, int x, int y) {
         return false;
         // Erro ao alocar memória para nova antena.
     }
+    INSTR_CONTAR(CONTADOR_ALOC_ANTENA, 1);
 
     // Inicializa os dados da antena
     nova -> frequencia = frequencia;
@@ -20,17 +20,18 @@
 #define ANTENAS_H
 
 #include <stdbool.h>
+#include "frequencias.h"
 
 /** 
  * @struct Antena
  * @brief Representa uma antena com frequência e posição (x,y) no mapa.
  * 
  * Cada nó da lista ligada representa uma antena. A estrutura inclui a frequência
- * da antena (caractere) e as coordenadas x e y onde a antena está localizada.
+ * da antena (identificador do dicionário de frequências) e as coordenadas x e y onde a antena está localizada.
  */
 
 typedef struct Antena {
-    char frequencia;        /**< Frequência da antena */
+    Frequencia frequencia;  /**< Frequência da antena */
     int x, y;               /**< Coordenadas (x,y) da antena no mapa. */
     struct Antena *proximo; /**< Apontador para a próxima antena na lista */
 } Antena;
@@ -62,6 +63,6 @@ typedef struct Coordenada {
  * @return Apontador para o novo início da lista ou NULL em caso de erro ou duplicada.
  */
 
-Antena *inserirAntena(Antena *lista, char frequencia, int x, int y);
+Antena *inserirAntena(Antena *lista, Frequencia frequencia, int x, int y);
 
 #endif
@@ -0,0 +1,611 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file benchmark.c
+ * @author Thiago Abreu
+ * @brief Implementação dos benchmarks das procuras em largura.
+ *
+ * Compara `procuraLargura` (listas ligadas) com a procura paralela sobre o grafo
+ * compacto, em grafos gerados com poucas frequências e grau elevado, e confirma
+ * que ambas alcançam o mesmo conjunto de vértices.
+ *
+ * O conjunto de escalabilidade gera mapas e grafos determinísticos de tamanho
+ * crescente e mede o carregamento, a inserção e remoção, os locais nefastos, as
+ * procuras, a enumeração de caminhos e as interseções de frequências. As versões
+ * de referência (listas ligadas) só são medidas até um limite por secção, porque
+ * várias têm custo quadrático ou exponencial.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "benchmark.h"
+#include "funcoes.h"
+#include "gerador.h"
+#include "grafocsr.h"
+#include "procuras.h"
+#include "caminhos.h"
+#include "nefastos.h"
+#include "compacto.h"
+#include "ligacoes.h"
+#include "tempo.h"
+
+/** Acima deste número de vértices a procura de referência não é medida (custo quadrático). */
+#define LIMITE_REFERENCIA 5000
+
+/** Ficheiro temporário usado para medir o carregamento de mapas. */
+#define FICHEIRO_MAPA_BENCHMARK "benchmark_mapa.tmp"
+
+/** Número de inserções (e remoções) medidas por tamanho de mapa. */
+#define OPERACOES_LISTA 1000
+
+/** Limites das versões de referência em cada secção do conjunto de escalabilidade. */
+#define LIMITE_REFERENCIA_NEFASTOS 1000
+#define LIMITE_REFERENCIA_PROFUNDIDADE 400
+#define LIMITE_REFERENCIA_CAMINHOS 18
+
+/** Caminhos e tempo máximos da enumeração de caminhos em cada medição. */
+#define MAX_CAMINHOS_BENCHMARK 200000
+#define TEMPO_CAMINHOS_BENCHMARK 2.0
+
+/** Origens das procuras em lote que comparam a ordem (x, y) com a de Hilbert. */
+#define ORIGENS_HILBERT ORIGENS_POR_LOTE
+
+/**
+ * @struct LinhaEscala
+ * @brief Medição anterior de uma secção, para calcular o expoente de crescimento.
+ */
+
+typedef struct LinhaEscala {
+    double tamanho;            /**< Tamanho da entrada anterior (0 se não houver) */
+    double tempoReferencia;    /**< Tempo da referência nessa entrada (-1 se não medido) */
+    double tempoOtimizado;     /**< Tempo da versão otimizada nessa entrada (-1 se não medido) */
+} LinhaEscala;
+
+/**
+ * @brief Verifica se uma lista de coordenadas coincide com o conjunto alcançado na tabela.
+ *
+ * @param g Grafo compacto.
+ * @param d Tabela de distâncias com uma origem.
+ * @param lista Lista de coordenadas devolvida pela procura de referência.
+ * @return true se os dois conjuntos forem iguais.
+ */
+
+static bool mesmoConjunto(const GrafoCSR *g, const DistanciasLargura *d, Coordenada *lista) {
+
+    int naLista = 0;
+    for (Coordenada *c = lista; c; c = c -> proximo) {
+        int v = indiceVerticeCSR(g, c -> x, c -> y);
+        if (v < 0 || d -> distancias[v] < 0) return false;
+        naLista++;
+    }
+
+    int naTabela = 0;
+    for (int v = 0; v < g -> numVertices; v++) {
+        if (d -> distancias[v] >= 0) naTabela++;
+    }
+
+    return naLista == naTabela;
+
+}
+
+/**
+ * @brief Mede a procura em largura paralela em grafos densos de tamanho crescente.
+ *
+ * Para cada tamanho gera um grafo com duas frequências e grau médio 32, e mede
+ * a procura de referência (até LIMITE_REFERENCIA vértices), a procura compacta
+ * na thread atual e repartida pelo conjunto de threads.
+ *
+ * @param pool Conjunto de threads da procura paralela.
+ */
+
+void benchmarkLarguraParalela(PoolTarefas *pool) {
+
+    int numThreads = numThreadsPool(pool);
+
+    const int tamanhos[] = { 5000, 20000, 80000, 320000 };
+    const int numTamanhos = (int)(sizeof(tamanhos) / sizeof(tamanhos[0]));
+
+    printf("\n===============================================================\n");
+    printf(" PROCURA EM LARGURA PARALELA (2 frequências, grau médio 32)\n");
+    printf("===============================================================\n");
+    printf("| VERTICES | REFERENCIA (s) | 1 THREAD (s) | %2d THREADS (s) | IGUAL |\n", numThreads);
+    printf("===============================================================\n");
+
+    for (int t = 0; t < numTamanhos; t++) {
+
+        Vertice *grafo = gerarGrafoDenso(tamanhos[t], 2, 32, 2025u + t);
+        GrafoCSR *g = construirGrafoCSR(grafo);
+        if (!grafo || !g) {
+            printf("Erro ao gerar o grafo com %d vértices.\n", tamanhos[t]);
+            libertarGrafoCSR(g);
+            libertarGrafo(grafo);
+            return;
+        }
+
+        int origem = 0;
+        double tempoReferencia = -1.0;
+        Coordenada *referencia = NULL;
+
+        if (g -> numVertices <= LIMITE_REFERENCIA) {
+            double inicio = tempoAtual();
+            referencia = procuraLargura(grafo, g -> x[origem], g -> y[origem]);
+            tempoReferencia = tempoAtual() - inicio;
+        }
+
+        double inicio = tempoAtual();
+        DistanciasLargura *sequencial = procuraLarguraParalela(g, origem, NULL);
+        double tempoSequencial = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        DistanciasLargura *paralela = procuraLarguraParalela(g, origem, pool);
+        double tempoParalelo = tempoAtual() - inicio;
+
+        bool igual = sequencial && paralela;
+        for (int v = 0; igual && v < g -> numVertices; v++) {
+            igual = sequencial -> distancias[v] == paralela -> distancias[v];
+        }
+        if (igual && referencia) {
+            igual = mesmoConjunto(g, paralela, referencia);
+        }
+
+        if (tempoReferencia >= 0) {
+            printf("| %8d | %14.4f | %12.4f | %14.4f | %-5s |\n", g -> numVertices,
+                   tempoReferencia, tempoSequencial, tempoParalelo, igual ? "sim" : "NAO");
+        } else {
+            printf("| %8d | %14s | %12.4f | %14.4f | %-5s |\n", g -> numVertices,
+                   "-", tempoSequencial, tempoParalelo, igual ? "sim" : "NAO");
+        }
+
+        libertarCoordenadas(referencia);
+        libertarDistanciasLargura(sequencial);
+        libertarDistanciasLargura(paralela);
+        libertarGrafoCSR(g);
+        libertarGrafo(grafo);
+
+    }
+
+    printf("===============================================================\n");
+
+}
+
+/**
+ * @brief Logaritmo natural, sem depender da biblioteca matemática.
+ *
+ * @param v Valor positivo.
+ * @return ln(v), ou 0 se v não for positivo.
+ */
+
+static double logaritmo(double v) {
+
+    if (v <= 0.0) return 0.0;
+
+    int expoente = 0;
+    while (v > 2.0) { v /= 2.0; expoente++; }
+    while (v < 1.0) { v *= 2.0; expoente--; }
+
+    // ln(v) = 2 atanh((v - 1) / (v + 1)), com v em [1, 2]
+    double z = (v - 1.0) / (v + 1.0), z2 = z * z, termo = z, soma = 0.0;
+    for (int i = 1; i < 40; i += 2) {
+        soma += termo / i;
+        termo *= z2;
+    }
+
+    return 2.0 * soma + expoente * 0.69314718055994531;
+
+}
+
+/**
+ * @brief Escreve o cabeçalho de uma secção do conjunto de escalabilidade.
+ *
+ * @param titulo Título da secção.
+ * @param unidade Unidade do débito (por exemplo, "antenas/s").
+ */
+
+static void cabecalhoSecao(const char *titulo, const char *unidade) {
+
+    printf("\n==========================================================================================\n");
+    printf(" %s\n", titulo);
+    printf("==========================================================================================\n");
+    printf("| %9s | %14s | %14s | %16s | %8s | %8s |\n", "TAMANHO", "REFERENCIA (s)", "OTIMIZADA (s)", unidade, "EXP REF", "EXP OTIM");
+    printf("==========================================================================================\n");
+
+}
+
+/**
+ * @brief Calcula o expoente de crescimento entre duas medições.
+ *
+ * @param destino Texto a preencher ("-" se não for possível estimar).
+ * @param tamanhoAnterior Tamanho da medição anterior.
+ * @param tempoAnterior Tempo da medição anterior.
+ * @param tamanho Tamanho da medição atual.
+ * @param tempo Tempo da medição atual.
+ */
+
+static void expoenteCrescimento(char destino[32], double tamanhoAnterior, double tempoAnterior, double tamanho, double tempo) {
+
+    // Tempos abaixo de 0.1 ms são demasiado ruidosos para estimar o expoente
+    if (tamanhoAnterior > 0 && tamanho > tamanhoAnterior && tempoAnterior > 1e-4 && tempo > 1e-4) {
+        snprintf(destino, 32, "%.2f", logaritmo(tempo / tempoAnterior) / logaritmo(tamanho / tamanhoAnterior));
+    } else {
+        snprintf(destino, 32, "-");
+    }
+
+}
+
+/**
+ * @brief Escreve uma linha de resultados e atualiza a medição anterior.
+ *
+ * O débito usa o tempo da versão otimizada quando existe e o da referência caso
+ * contrário. Tempos negativos indicam medições não realizadas.
+ *
+ * @param anterior Medição anterior da secção.
+ * @param tamanho Tamanho da entrada (antenas, vértices ou operações).
+ * @param tempoReferencia Tempo da versão de referência, ou -1.
+ * @param tempoOtimizado Tempo da versão otimizada, ou -1.
+ * @param elementos Elementos processados, para o débito.
+ */
+
+static void linhaSecao(LinhaEscala *anterior, double tamanho, double tempoReferencia, double tempoOtimizado, double elementos) {
+
+    char referencia[32] = "-", otimizada[32] = "-", debito[32] = "-", expoenteReferencia[32], expoenteOtimizado[32];
+    double tempo = tempoOtimizado >= 0 ? tempoOtimizado : tempoReferencia;
+
+    if (tempoReferencia >= 0) snprintf(referencia, sizeof(referencia), "%.4f", tempoReferencia);
+    if (tempoOtimizado >= 0) snprintf(otimizada, sizeof(otimizada), "%.4f", tempoOtimizado);
+    if (tempo > 0) snprintf(debito, sizeof(debito), "%.3e", elementos / tempo);
+
+    expoenteCrescimento(expoenteReferencia, anterior -> tamanho, anterior -> tempoReferencia, tamanho, tempoReferencia);
+    expoenteCrescimento(expoenteOtimizado, anterior -> tamanho, anterior -> tempoOtimizado, tamanho, tempoOtimizado);
+
+    printf("| %9.0f | %14s | %14s | %16s | %8s | %8s |\n", tamanho, referencia, otimizada, debito,
+           expoenteReferencia, expoenteOtimizado);
+
+    anterior -> tamanho = tamanho;
+    anterior -> tempoReferencia = tempoReferencia;
+    anterior -> tempoOtimizado = tempoOtimizado;
+
+}
+
+/**
+ * @brief Conta os elementos de uma lista de coordenadas.
+ *
+ * @param lista Lista de coordenadas.
+ * @return Número de elementos.
+ */
+
+static long contarCoordenadas(Coordenada *lista) {
+
+    long n = 0;
+    for (; lista; lista = lista -> proximo) n++;
+
+    return n;
+
+}
+
+/**
+ * @brief Cria um vértice por antena, já pela ordem (x, y) da lista, sem ligações.
+ *
+ * @param lista Lista de antenas (ordenada por (x, y)).
+ * @return Apontador para o início da lista de vértices, ou false em caso de erro.
+ */
+
+static Vertice *grafoDasAntenas(Antena *lista) {
+
+    Vertice *grafo = NULL, *ultimo = NULL;
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+
+        Vertice *v = criarVertice(a -> frequencia, a -> x, a -> y);
+        if (!v) {
+            return libertarGrafo(grafo);
+        }
+
+        if (ultimo) ultimo -> proximo = v;
+        else grafo = v;
+        v -> anterior = ultimo;
+        ultimo = v;
+
+    }
+
+    return grafo;
+
+}
+
+/**
+ * @brief Mede cada módulo em entradas de tamanho crescente.
+ *
+ * Os mapas têm densidade 5%, 8 frequências e agrupamento 0.5; os grafos para as
+ * procuras são gerados com `gerarGrafoDenso`. Todas as entradas usam sementes
+ * fixas, pelo que execuções sucessivas medem exatamente o mesmo trabalho.
+ *
+ * @param pool Conjunto de threads das versões paralelas.
+ */
+
+void benchmarkEscalabilidade(PoolTarefas *pool) {
+
+    const int lados[] = { 64, 128, 256, 512 };
+    const int numLados = (int)(sizeof(lados) / sizeof(lados[0]));
+    LinhaEscala anterior;
+
+    // Carregamento de ficheiro
+    cabecalhoSecao("CARREGAMENTO (carregarAntenas)", "antenas/s");
+    anterior.tamanho = 0;
+    for (int t = 0; t < numLados; t++) {
+
+        ParametrosMapa p = { lados[t], lados[t], 0.05, 8, 0.5, 2025u + t };
+        if (!gerarMapa(FICHEIRO_MAPA_BENCHMARK, p)) {
+            printf("Erro ao escrever o mapa %s.\n", FICHEIRO_MAPA_BENCHMARK);
+            return;
+        }
+
+        int linhas = 0, colunas = 0;
+        double inicio = tempoAtual();
+        Antena *lista = carregarAntenas(FICHEIRO_MAPA_BENCHMARK, &linhas, &colunas);
+        double tempo = tempoAtual() - inicio;
+
+        long n = 0;
+        for (Antena *a = lista; a; a = a -> proximo) n++;
+        linhaSecao(&anterior, (double)n, tempo, -1, (double)n);
+
+        libertarAntenas(lista);
+
+    }
+    remove(FICHEIRO_MAPA_BENCHMARK);
+
+    // Inserção e remoção em listas do tamanho de cada mapa
+    cabecalhoSecao("INSERIR + REMOVER (1000 de cada, por tamanho da lista)", "operacoes/s");
+    anterior.tamanho = 0;
+    for (int t = 0; t < numLados; t++) {
+
+        ParametrosMapa p = { lados[t], lados[t], 0.05, 8, 0.5, 2025u + t };
+        Antena *lista = gerarAntenas(p);
+        long n = 0;
+        for (Antena *a = lista; a; a = a -> proximo) n++;
+
+        unsigned int estado = 7u + t;
+        int xs[OPERACOES_LISTA], ys[OPERACOES_LISTA];
+
+        double inicio = tempoAtual();
+        for (int k = 0; k < OPERACOES_LISTA; k++) {
+            estado = estado * 1103515245u + 12345u;
+            xs[k] = (int)((estado >> 8) % (unsigned)lados[t]);
+            estado = estado * 1103515245u + 12345u;
+            ys[k] = (int)((estado >> 8) % (unsigned)lados[t]);
+            Antena *nova = inserirAntena(lista, frequenciaCaracter('z'), xs[k], ys[k]);
+            if (nova) lista = nova;
+            else xs[k] = -1; // Posição ocupada: não há nada a remover
+        }
+        for (int k = 0; k < OPERACOES_LISTA; k++) {
+            bool removido = false;
+            if (xs[k] >= 0) lista = removerAntena(lista, xs[k], ys[k], &removido);
+        }
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)n, tempo, -1, 2.0 * OPERACOES_LISTA);
+        libertarAntenas(lista);
+
+    }
+
+    // Locais nefastos
+    cabecalhoSecao("LOCAIS NEFASTOS (referencia / paralela)", "antenas/s");
+    anterior.tamanho = 0;
+    for (int t = 0; t < numLados; t++) {
+
+        ParametrosMapa p = { lados[t], lados[t], 0.05, 8, 0.5, 2025u + t };
+        Antena *lista = gerarAntenas(p);
+        long n = 0;
+        for (Antena *a = lista; a; a = a -> proximo) n++;
+
+        double tempoReferencia = -1.0;
+        if (n <= LIMITE_REFERENCIA_NEFASTOS) {
+            double inicio = tempoAtual();
+            libertarCoordenadas(detectarLocaisNefastos(lista));
+            tempoReferencia = tempoAtual() - inicio;
+        }
+
+        double inicio = tempoAtual();
+        libertarCoordenadas(detectarLocaisNefastosParalelo(lista, pool));
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)n, tempoReferencia, tempo, (double)n);
+        libertarAntenas(lista);
+
+    }
+
+    // Locais nefastos sobre a cópia compacta (a construção conta para o tempo)
+    cabecalhoSecao("LOCAIS NEFASTOS (paralela / compacta)", "antenas/s");
+    anterior.tamanho = 0;
+    long bytesLista = 0;
+    size_t bytesCompacta = 0;
+    for (int t = 0; t < numLados; t++) {
+
+        ParametrosMapa p = { lados[t], lados[t], 0.05, 8, 0.5, 2025u + t };
+        Antena *lista = gerarAntenas(p);
+        long n = 0;
+        for (Antena *a = lista; a; a = a -> proximo) n++;
+
+        double inicio = tempoAtual();
+        libertarCoordenadas(detectarLocaisNefastosParalelo(lista, pool));
+        double tempoLista = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        MapaCompacto *m = construirMapaCompacto(lista, p.linhas, p.colunas);
+        libertarCoordenadas(detectarNefastosCompacto(m, pool));
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)n, tempoLista, tempo, (double)n);
+        bytesLista = n * (long)sizeof(Antena);
+        bytesCompacta = bytesMapaCompacto(m);
+        libertarMapaCompacto(m);
+        libertarAntenas(lista);
+
+    }
+    printf("| memoria no maior mapa: %ld bytes na lista, %zu na copia compacta\n", bytesLista, bytesCompacta);
+
+    // Procuras em largura e em profundidade
+    const int vertices[] = { 250, 1000, 4000, 16000, 64000 };
+    const int numVertices = (int)(sizeof(vertices) / sizeof(vertices[0]));
+
+    for (int modo = 0; modo < 2; modo++) {
+
+        cabecalhoSecao(modo == 0 ? "PROCURA EM LARGURA (procuraLargura / CSR paralela, grau 4)"
+                                 : "PROCURA EM PROFUNDIDADE (procuraProfundidade / CSR, grau 2)", "vertices/s");
+        anterior.tamanho = 0;
+
+        for (int t = 0; t < numVertices; t++) {
+
+            Vertice *grafo = gerarGrafoDenso(vertices[t], 1, modo == 0 ? 4 : 2, 77u + t);
+            GrafoCSR *g = construirGrafoCSR(grafo);
+            if (!grafo || !g) {
+                libertarGrafoCSR(g);
+                libertarGrafo(grafo);
+                break;
+            }
+
+            double tempoReferencia = -1.0, tempo;
+            long alcancados = 0;
+
+            if (modo == 0) {
+                if (g -> numVertices <= LIMITE_REFERENCIA) {
+                    double inicio = tempoAtual();
+                    libertarCoordenadas(procuraLargura(grafo, g -> x[0], g -> y[0]));
+                    tempoReferencia = tempoAtual() - inicio;
+                }
+                double inicio = tempoAtual();
+                DistanciasLargura *d = procuraLarguraParalela(g, 0, pool);
+                tempo = tempoAtual() - inicio;
+                for (int v = 0; d && v < g -> numVertices; v++) {
+                    if (d -> distancias[v] >= 0) alcancados++;
+                }
+                libertarDistanciasLargura(d);
+            } else {
+                if (g -> numVertices <= LIMITE_REFERENCIA_PROFUNDIDADE) {
+                    double inicio = tempoAtual();
+                    libertarCoordenadas(procuraProfundidade(grafo, g -> x[0], g -> y[0]));
+                    tempoReferencia = tempoAtual() - inicio;
+                }
+                double inicio = tempoAtual();
+                Coordenada *r = procuraProfundidadeCSR(g, 0);
+                tempo = tempoAtual() - inicio;
+                alcancados = contarCoordenadas(r);
+                libertarCoordenadas(r);
+            }
+
+            linhaSecao(&anterior, (double)g -> numVertices, tempoReferencia, tempo, (double)alcancados);
+            libertarGrafoCSR(g);
+            libertarGrafo(grafo);
+
+        }
+
+    }
+
+    // Localidade: grafo espacial (vizinhos a distância <= 1.5) com os vértices em ordem (x, y) ou de Hilbert
+    cabecalhoSecao("LARGURA EM LOTE, 64 ORIGENS (ordem (x, y) / Hilbert, vizinhos a 1.5)", "vertices/s");
+    anterior.tamanho = 0;
+    for (int t = 0; t < numLados - 1; t++) {
+
+        ParametrosMapa p = { 2 * lados[t], 2 * lados[t], 0.6, 1, 0.0, 31u + t };
+        Antena *lista = gerarAntenas(p);
+        Vertice *grafo = grafoDasAntenas(lista);
+        libertarAntenas(lista);
+        GrafoCSR *g = grafo && ligarRaio(grafo, 1.5) >= 0 ? construirGrafoCSR(grafo) : NULL;
+        GrafoCSR *h = reordenarGrafoCSR(g);
+
+        if (!g || !h || g -> numVertices < ORIGENS_HILBERT) {
+            libertarGrafoCSR(g);
+            libertarGrafoCSR(h);
+            libertarGrafo(grafo);
+            continue;
+        }
+
+        int origens[ORIGENS_HILBERT], origensHilbert[ORIGENS_HILBERT];
+        for (int k = 0; k < ORIGENS_HILBERT; k++) {
+            origens[k] = (int)((long long)k * g -> numVertices / ORIGENS_HILBERT);
+            origensHilbert[k] = indiceVerticeCSR(h, g -> x[origens[k]], g -> y[origens[k]]);
+        }
+
+        double inicio = tempoAtual();
+        libertarDistanciasLargura(procuraLarguraMultipla(g, origens, ORIGENS_HILBERT));
+        double tempoLinhas = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        libertarDistanciasLargura(procuraLarguraMultipla(h, origensHilbert, ORIGENS_HILBERT));
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)g -> numVertices, tempoLinhas, tempo, (double)g -> numVertices * ORIGENS_HILBERT);
+        libertarGrafoCSR(g);
+        libertarGrafoCSR(h);
+        libertarGrafo(grafo);
+
+    }
+
+    // Enumeração de caminhos (limitada em número e em tempo)
+    cabecalhoSecao("CAMINHOS ENTRE ANTENAS (referencia / paralela, grau 4)", "caminhos/s");
+    anterior.tamanho = 0;
+    const int verticesCaminhos[] = { 10, 14, 18, 22, 26 };
+    for (int t = 0; t < (int)(sizeof(verticesCaminhos) / sizeof(verticesCaminhos[0])); t++) {
+
+        Vertice *grafo = gerarGrafoDenso(verticesCaminhos[t], 1, 4, 91u + verticesCaminhos[t]);
+        GrafoCSR *g = construirGrafoCSR(grafo);
+        if (!grafo || !g) {
+            libertarGrafoCSR(g);
+            libertarGrafo(grafo);
+            break;
+        }
+
+        int destino = g -> numVertices - 1;
+        double tempoReferencia = -1.0;
+        if (g -> numVertices <= LIMITE_REFERENCIA_CAMINHOS) {
+            double inicio = tempoAtual();
+            libertarCoordenadas(caminhosEntreAntenas(grafo, g -> x[0], g -> y[0], g -> x[destino], g -> y[destino]));
+            tempoReferencia = tempoAtual() - inicio;
+        }
+
+        LimitesCaminhos limites = { MAX_CAMINHOS_BENCHMARK, TEMPO_CAMINHOS_BENCHMARK, 0 };
+        if (t == 0) {
+            // Aquece as threads do conjunto antes da primeira medição
+            libertarListaCaminhos(caminhosEntreAntenasParalelo(g, pool, g -> x[0], g -> y[0], g -> x[destino], g -> y[destino], limites));
+        }
+        double inicio = tempoAtual();
+        ListaCaminhos *l = caminhosEntreAntenasParalelo(g, pool, g -> x[0], g -> y[0], g -> x[destino], g -> y[destino], limites);
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)g -> numVertices, tempoReferencia, tempo, l ? (double)l -> numCaminhos : 0.0);
+        libertarListaCaminhos(l);
+        libertarGrafoCSR(g);
+        libertarGrafo(grafo);
+
+    }
+
+    // Interseções de frequências
+    cabecalhoSecao("INTERSECOES DE FREQUENCIAS (intersecoesFrequencias)", "pares/s");
+    anterior.tamanho = 0;
+    const int verticesIntersecoes[] = { 250, 500, 1000, 2000 };
+    for (int t = 0; t < (int)(sizeof(verticesIntersecoes) / sizeof(verticesIntersecoes[0])); t++) {
+
+        Vertice *grafo = gerarGrafoDenso(verticesIntersecoes[t], 8, 0, 55u + t);
+        Frequencia freqA = frequenciaCaracter('A'), freqB = frequenciaCaracter('B');
+        long a = 0, b = 0;
+        for (Vertice *v = grafo; v; v = v -> proximo) {
+            if (v -> frequencia == freqA) a++;
+            else if (v -> frequencia == freqB) b++;
+        }
+
+        double inicio = tempoAtual();
+        libertarCoordenadas(intersecoesFrequencias(grafo, freqA, freqB));
+        double tempo = tempoAtual() - inicio;
+
+        linhaSecao(&anterior, (double)verticesIntersecoes[t], tempo, -1, (double)(a * b));
+        libertarGrafo(grafo);
+
+    }
+
+    printf("==========================================================================================\n");
+
+}
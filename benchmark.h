@@ -0,0 +1,27 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file benchmark.h
+ * @author Thiago Abreu
+ * @brief Medição de desempenho das procuras sobre grafos sintéticos.
+ *
+ * `benchmarkEscalabilidade` mede cada módulo em entradas de tamanho crescente e
+ * indica, para cada tamanho, o débito e o expoente de crescimento do tempo
+ * (1 para linear, 2 para quadrático) face ao tamanho anterior.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "tarefas.h"
+
+void benchmarkLarguraParalela(PoolTarefas *pool);
+void benchmarkEscalabilidade(PoolTarefas *pool);
+
+#endif
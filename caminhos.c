@@ -0,0 +1,460 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file caminhos.c
+ * @author Thiago Abreu
+ * @brief Implementação da enumeração paralela de caminhos simples.
+ *
+ * Os primeiros níveis da árvore de procura dão origem a uma tarefa por ramo; abaixo
+ * da profundidade de divisão cada tarefa continua sozinha com uma procura em
+ * profundidade iterativa, com o seu próprio caminho e mapa de visitados.
+ * Os caminhos completos são juntos numa única lista protegida por um trinco.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "caminhos.h"
+#include "funcoes.h"
+#include "tempo.h"
+
+/** Passos da procura entre duas verificações do limite de tempo. */
+#define PASSOS_ENTRE_VERIFICACOES 1024
+
+/**
+ * @struct EstadoCaminhos
+ * @brief Estado partilhado por todas as tarefas de uma enumeração.
+ */
+
+typedef struct EstadoCaminhos {
+    const GrafoCSR *g;          /**< Grafo percorrido */
+    PoolTarefas *pool;          /**< Conjunto onde as tarefas são submetidas */
+    GrupoTarefas grupo;         /**< Tarefas desta enumeração */
+    int destino;                /**< Índice CSR do destino */
+    int profundidadeDivisao;    /**< Níveis divididos em tarefas */
+    long maxCaminhos;           /**< Limite de caminhos (0 sem limite) */
+    double prazo;               /**< Instante limite (0 sem limite) */
+    _Atomic long reservados;    /**< Caminhos já aceites */
+    atomic_bool parar;          /**< Indica às tarefas que devem terminar */
+    pthread_mutex_t trinco;     /**< Protege o resultado */
+    ListaCaminhos *resultado;   /**< Caminhos encontrados */
+} EstadoCaminhos;
+
+/**
+ * @struct TarefaCaminho
+ * @brief Um ramo da árvore de procura, identificado pelo caminho desde a origem.
+ */
+
+typedef struct TarefaCaminho {
+    EstadoCaminhos *estado;   /**< Estado partilhado */
+    int comprimento;          /**< Número de vértices do prefixo */
+    int prefixo[];            /**< Vértices desde a origem até ao início do ramo */
+} TarefaCaminho;
+
+/**
+ * @brief Interrompe a enumeração e marca o resultado como parcial.
+ *
+ * @param e Estado partilhado.
+ */
+
+static void interromper(EstadoCaminhos *e) {
+
+    pthread_mutex_lock(&e -> trinco);
+    e -> resultado -> parcial = true;
+    pthread_mutex_unlock(&e -> trinco);
+    atomic_store(&e -> parar, true);
+
+}
+
+/**
+ * @brief Verifica se a enumeração deve parar (limite atingido ou prazo excedido).
+ *
+ * @param e Estado partilhado.
+ * @return true se a procura deve terminar.
+ */
+
+static bool deveParar(EstadoCaminhos *e) {
+
+    if (atomic_load_explicit(&e -> parar, memory_order_relaxed)) {
+        return true;
+    }
+
+    if (e -> prazo > 0 && tempoAtual() > e -> prazo) {
+        interromper(e);
+        return true;
+    }
+
+    return false;
+
+}
+
+/**
+ * @brief Acrescenta um caminho completo ao resultado, respeitando o limite de caminhos.
+ *
+ * @param e Estado partilhado.
+ * @param caminho Vértices do caminho, da origem ao destino.
+ * @param comprimento Número de vértices do caminho.
+ */
+
+static void registarCaminho(EstadoCaminhos *e, const int *caminho, int comprimento) {
+
+    if (atomic_load(&e -> parar)) return;
+
+    if (e -> maxCaminhos > 0) {
+        long posicao = atomic_fetch_add(&e -> reservados, 1);
+        if (posicao >= e -> maxCaminhos) {
+            interromper(e);
+            return;
+        }
+    }
+
+    pthread_mutex_lock(&e -> trinco);
+
+    ListaCaminhos *l = e -> resultado;
+    bool espaco = true;
+
+    if (l -> numCaminhos + 1 >= l -> capacidadeCaminhos) {
+        int nova = l -> capacidadeCaminhos * 2;
+        int *tmp = (int *)realloc(l -> inicioCaminho, nova * sizeof(int));
+        if (tmp) {
+            l -> inicioCaminho = tmp;
+            l -> capacidadeCaminhos = nova;
+        } else {
+            espaco = false;
+        }
+    }
+
+    int usados = l -> inicioCaminho[l -> numCaminhos];
+    if (espaco && usados + comprimento > l -> capacidadeVertices) {
+        int nova = l -> capacidadeVertices * 2;
+        while (nova < usados + comprimento) nova *= 2;
+        int *tmp = (int *)realloc(l -> vertices, nova * sizeof(int));
+        if (tmp) {
+            l -> vertices = tmp;
+            l -> capacidadeVertices = nova;
+        } else {
+            espaco = false;
+        }
+    }
+
+    if (espaco) {
+        memcpy(l -> vertices + usados, caminho, comprimento * sizeof(int));
+        l -> numCaminhos++;
+        l -> inicioCaminho[l -> numCaminhos] = usados + comprimento;
+    } else {
+        // Sem memória: devolve o que já foi encontrado
+        l -> parcial = true;
+        atomic_store(&e -> parar, true);
+    }
+
+    pthread_mutex_unlock(&e -> trinco);
+
+}
+
+/**
+ * @brief Enumera sequencialmente todos os caminhos simples que estendem um prefixo.
+ *
+ * Procura em profundidade iterativa: para cada nível guarda a próxima aresta a
+ * experimentar, evitando a recursão e as listas ligadas da versão de referência.
+ *
+ * @param e Estado partilhado.
+ * @param prefixo Caminho desde a origem até ao vértice onde a procura começa.
+ * @param comprimento Número de vértices do prefixo.
+ */
+
+static void procurarSequencial(EstadoCaminhos *e, const int *prefixo, int comprimento) {
+
+    const GrafoCSR *g = e -> g;
+    int palavras = (g -> numVertices + 63) / 64;
+    int capacidade = comprimento + 64;
+
+    uint64_t *visitados = (uint64_t *)calloc(palavras, sizeof(uint64_t));
+    int *caminho = (int *)malloc(capacidade * sizeof(int));
+    int *proxima = (int *)malloc(capacidade * sizeof(int));
+
+    if (!visitados || !caminho || !proxima) {
+        free(visitados);
+        free(caminho);
+        free(proxima);
+        interromper(e);
+        return;
+    }
+
+    for (int i = 0; i < comprimento; i++) {
+        caminho[i] = prefixo[i];
+        visitados[prefixo[i] >> 6] |= (uint64_t)1 << (prefixo[i] & 63);
+    }
+
+    int topo = comprimento - 1;
+    proxima[topo] = g -> inicioArestas[caminho[topo]];
+    long passos = 0;
+
+    while (topo >= comprimento - 1) {
+
+        if (++passos % PASSOS_ENTRE_VERIFICACOES == 0 && deveParar(e)) break;
+
+        int v = caminho[topo];
+
+        if (proxima[topo] == g -> inicioArestas[v + 1]) {
+            // Ramo esgotado: recua, libertando o vértice se não pertencer ao prefixo
+            if (topo >= comprimento) {
+                visitados[v >> 6] &= ~((uint64_t)1 << (v & 63));
+            }
+            topo--;
+            continue;
+        }
+
+        int w = g -> destinos[proxima[topo]++];
+        if (visitados[w >> 6] & ((uint64_t)1 << (w & 63))) continue;
+
+        if (topo + 2 > capacidade) {
+            int nova = capacidade * 2;
+            int *c = (int *)realloc(caminho, nova * sizeof(int));
+            if (c) caminho = c;
+            int *p = (int *)realloc(proxima, nova * sizeof(int));
+            if (p) proxima = p;
+            if (!c || !p) {
+                interromper(e);
+                break;
+            }
+            capacidade = nova;
+        }
+
+        caminho[topo + 1] = w;
+
+        if (w == e -> destino) {
+            registarCaminho(e, caminho, topo + 2);
+            if (atomic_load_explicit(&e -> parar, memory_order_relaxed)) break;
+            continue;
+        }
+
+        topo++;
+        visitados[w >> 6] |= (uint64_t)1 << (w & 63);
+        proxima[topo] = g -> inicioArestas[w];
+
+    }
+
+    free(visitados);
+    free(caminho);
+    free(proxima);
+
+}
+
+/**
+ * @brief Cria uma tarefa para o ramo que estende um prefixo com mais um vértice.
+ *
+ * @param e Estado partilhado.
+ * @param prefixo Prefixo atual.
+ * @param comprimento Número de vértices do prefixo.
+ * @param v Vértice acrescentado (pode ser -1 para copiar apenas o prefixo).
+ * @return Nova tarefa, ou NULL em caso de falha de memória.
+ */
+
+static TarefaCaminho *criarTarefaCaminho(EstadoCaminhos *e, const int *prefixo, int comprimento, int v) {
+
+    int total = comprimento + (v >= 0 ? 1 : 0);
+    TarefaCaminho *t = (TarefaCaminho *)malloc(sizeof(TarefaCaminho) + total * sizeof(int));
+    if (!t) {
+        return NULL;
+    }
+
+    t -> estado = e;
+    t -> comprimento = total;
+    memcpy(t -> prefixo, prefixo, comprimento * sizeof(int));
+    if (v >= 0) t -> prefixo[comprimento] = v;
+
+    return t;
+
+}
+
+/**
+ * @brief Executa um ramo: divide-o em sub-tarefas ou enumera-o sequencialmente.
+ *
+ * @param arg Apontador para a TarefaCaminho (libertada no fim).
+ */
+
+static void executarTarefaCaminho(void *arg) {
+
+    TarefaCaminho *t = (TarefaCaminho *)arg;
+    EstadoCaminhos *e = t -> estado;
+    const GrafoCSR *g = e -> g;
+
+    if (deveParar(e)) {
+        free(t);
+        return;
+    }
+
+    int v = t -> prefixo[t -> comprimento - 1];
+
+    if (v == e -> destino) {
+
+        registarCaminho(e, t -> prefixo, t -> comprimento);
+
+    } else if (e -> pool && t -> comprimento <= e -> profundidadeDivisao) {
+
+        for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+
+            int w = g -> destinos[k];
+
+            bool noPrefixo = false;
+            for (int i = 0; i < t -> comprimento && !noPrefixo; i++) {
+                noPrefixo = t -> prefixo[i] == w;
+            }
+            if (noPrefixo) continue;
+
+            TarefaCaminho *filha = criarTarefaCaminho(e, t -> prefixo, t -> comprimento, w);
+            if (!filha) {
+                interromper(e);
+                break;
+            }
+
+            if (!submeterGrupo(&e -> grupo, executarTarefaCaminho, filha)) {
+                executarTarefaCaminho(filha);
+            }
+
+        }
+
+    } else {
+
+        procurarSequencial(e, t -> prefixo, t -> comprimento);
+
+    }
+
+    free(t);
+
+}
+
+/**
+ * @brief Enumera em paralelo todos os caminhos simples entre duas antenas.
+ *
+ * Explora os mesmos caminhos que `caminhosEntreAntenas`, mas devolve-os em separado.
+ * Os ramos dos primeiros `profundidadeDivisao` níveis são tarefas independentes no
+ * conjunto de threads. Se for atingido o limite de tempo, ou se existir mais algum
+ * caminho além dos `maxCaminhos` guardados, devolve os caminhos já encontrados com
+ * `parcial` a true; encontrar exatamente `maxCaminhos` caminhos não torna o resultado
+ * parcial. Sem conjunto de threads, a procura decorre na thread que chama a função.
+ *
+ * @param g Grafo compacto.
+ * @param pool Conjunto de threads (pode ser NULL).
+ * @param x1 Coordenada X da antena de origem.
+ * @param y1 Coordenada Y da antena de origem.
+ * @param x2 Coordenada X da antena de destino.
+ * @param y2 Coordenada Y da antena de destino.
+ * @param limites Limites de caminhos, de tempo e de divisão.
+ * @return Lista de caminhos encontrados, ou false se alguma antena não existir ou em caso de erro.
+ */
+
+ListaCaminhos *caminhosEntreAntenasParalelo(const GrafoCSR *g, PoolTarefas *pool, int x1, int y1, int x2, int y2, LimitesCaminhos limites) {
+
+    int origem = indiceVerticeCSR(g, x1, y1);
+    int destino = indiceVerticeCSR(g, x2, y2);
+
+    if (origem < 0 || destino < 0) {
+        return false;
+    }
+
+    ListaCaminhos *l = (ListaCaminhos *)calloc(1, sizeof(ListaCaminhos));
+    if (!l) {
+        return false;
+    }
+
+    l -> capacidadeCaminhos = 16;
+    l -> capacidadeVertices = 256;
+    l -> inicioCaminho = (int *)malloc(l -> capacidadeCaminhos * sizeof(int));
+    l -> vertices = (int *)malloc(l -> capacidadeVertices * sizeof(int));
+    if (!l -> inicioCaminho || !l -> vertices) {
+        return libertarListaCaminhos(l);
+    }
+    l -> inicioCaminho[0] = 0;
+
+    EstadoCaminhos e;
+    e.g = g;
+    e.pool = pool;
+    e.destino = destino;
+    e.profundidadeDivisao = limites.profundidadeDivisao > 0 ? limites.profundidadeDivisao : PROFUNDIDADE_DIVISAO_PADRAO;
+    e.maxCaminhos = limites.maxCaminhos;
+    e.prazo = limites.tempoMaximo > 0 ? tempoAtual() + limites.tempoMaximo : 0;
+    atomic_init(&e.reservados, 0);
+    atomic_init(&e.parar, false);
+    pthread_mutex_init(&e.trinco, NULL);
+    iniciarGrupo(&e.grupo, pool);
+    e.resultado = l;
+
+    TarefaCaminho *raiz = criarTarefaCaminho(&e, &origem, 1, -1);
+    if (!raiz) {
+        pthread_mutex_destroy(&e.trinco);
+        return libertarListaCaminhos(l);
+    }
+
+    // A thread que chama trata a raiz e depois ajuda nas restantes tarefas
+    executarTarefaCaminho(raiz);
+    aguardarGrupo(&e.grupo);
+
+    pthread_mutex_destroy(&e.trinco);
+
+    return l;
+
+}
+
+/**
+ * @brief Converte um dos caminhos encontrados numa lista de coordenadas.
+ *
+ * @param l Lista de caminhos.
+ * @param g Grafo compacto usado na procura.
+ * @param indice Posição do caminho na lista.
+ * @return Lista de coordenadas da origem ao destino, ou false se o índice for inválido ou faltar memória.
+ */
+
+Coordenada *coordenadasCaminho(const ListaCaminhos *l, const GrafoCSR *g, int indice) {
+
+    if (!l || !g || indice < 0 || indice >= l -> numCaminhos) {
+        return false;
+    }
+
+    Coordenada *resultado = NULL;
+
+    for (int k = l -> inicioCaminho[indice + 1] - 1; k >= l -> inicioCaminho[indice]; k--) {
+
+        Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+        if (!nova) {
+            return libertarCoordenadas(resultado);
+        }
+
+        nova -> x = g -> x[l -> vertices[k]];
+        nova -> y = g -> y[l -> vertices[k]];
+        nova -> proximo = resultado;
+        resultado = nova;
+
+    }
+
+    return resultado;
+
+}
+
+/**
+ * @brief Liberta a memória de uma lista de caminhos.
+ *
+ * @param l Lista de caminhos.
+ * @return false após a libertação completa.
+ */
+
+ListaCaminhos *libertarListaCaminhos(ListaCaminhos *l) {
+
+    if (!l) {
+        return false;
+    }
+
+    free(l -> inicioCaminho);
+    free(l -> vertices);
+    free(l);
+
+    return false;
+
+}
@@ -0,0 +1,61 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file caminhos.h
+ * @author Thiago Abreu
+ * @brief Enumeração paralela de caminhos simples entre duas antenas.
+ *
+ * Alternativa a `caminhosEntreAntenas` que divide a árvore de procura em tarefas
+ * executadas pelo conjunto de threads, com limite de caminhos e de tempo.
+ */
+
+#ifndef CAMINHOS_H
+#define CAMINHOS_H
+
+#include <stdbool.h>
+#include "antenas.h"
+#include "grafocsr.h"
+#include "tarefas.h"
+
+/** Número de níveis da árvore de procura divididos em tarefas, por omissão. */
+#define PROFUNDIDADE_DIVISAO_PADRAO 3
+
+/**
+ * @struct LimitesCaminhos
+ * @brief Limites de uma enumeração de caminhos; o valor 0 significa "sem limite".
+ */
+
+typedef struct LimitesCaminhos {
+    long maxCaminhos;          /**< Número máximo de caminhos a devolver */
+    double tempoMaximo;        /**< Tempo máximo da procura, em segundos */
+    int profundidadeDivisao;   /**< Níveis divididos em tarefas (0 usa PROFUNDIDADE_DIVISAO_PADRAO) */
+} LimitesCaminhos;
+
+/**
+ * @struct ListaCaminhos
+ * @brief Caminhos encontrados, guardados de forma contígua.
+ *
+ * O caminho `i` ocupa `vertices[inicioCaminho[i]]` até `vertices[inicioCaminho[i + 1] - 1]`,
+ * da origem para o destino, com índices do grafo compacto.
+ */
+
+typedef struct ListaCaminhos {
+    int numCaminhos;        /**< Número de caminhos encontrados */
+    int *inicioCaminho;     /**< Início de cada caminho (numCaminhos + 1 entradas) */
+    int *vertices;          /**< Vértices de todos os caminhos, em sequência */
+    int capacidadeCaminhos; /**< Capacidade reservada em inicioCaminho */
+    int capacidadeVertices; /**< Capacidade reservada em vertices */
+    bool parcial;           /**< true se a procura parou por atingir um limite */
+} ListaCaminhos;
+
+ListaCaminhos *caminhosEntreAntenasParalelo(const GrafoCSR *g, PoolTarefas *pool, int x1, int y1, int x2, int y2, LimitesCaminhos limites);
+Coordenada *coordenadasCaminho(const ListaCaminhos *l, const GrafoCSR *g, int indice);
+ListaCaminhos *libertarListaCaminhos(ListaCaminhos *l);
+
+#endif
@@ -0,0 +1,455 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file compacto.c
+ * @author Thiago Abreu
+ * @brief Construção da cópia compacta das antenas e deteção de locais nefastos sobre ela.
+ *
+ * A construção faz uma ordenação por contagem estável pela chave de grupo. O núcleo
+ * dos locais nefastos marca os pontos médios num mapa de bits do retângulo coberto,
+ * repartindo as antenas de partida pelas threads como `detectarLocaisNefastosParalelo`;
+ * quando o retângulo é demasiado grande para o mapa de bits, junta as células num
+ * vetor que é ordenado no fim por radix. Em ambos os casos a lista sai por ordem (x, y).
+ */
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "compacto.h"
+#include "funcoes.h"
+#include "ordenacao.h"
+#include "instrumentacao.h"
+
+/** Área máxima (em células) do mapa de bits dos locais nefastos. */
+#define LIMITE_CELULAS_COMPACTO (1LL << 30)
+
+/** Antenas de partida por tarefa na deteção paralela. */
+#define GRAO_COMPACTO 32
+
+/**
+ * @struct EstadoCompacto
+ * @brief Dados partilhados pelas tarefas da deteção sobre o mapa compacto.
+ */
+
+typedef struct EstadoCompacto {
+    const MapaCompacto *m;        /**< Mapa compacto */
+    _Atomic uint64_t *marcados;   /**< Mapa de bits das células nefastas */
+} EstadoCompacto;
+
+/**
+ * @brief Arredonda para baixo até ao par mais próximo (também para negativos).
+ *
+ * @param v Valor.
+ * @return Maior par menor ou igual a v.
+ */
+
+static long long parAbaixo(long long v) {
+
+    return v - (v & 1);
+
+}
+
+/**
+ * @brief Grupo da antena guardada numa posição.
+ *
+ * @param m Mapa compacto.
+ * @param i Posição (0 <= i < numAntenas).
+ * @return Índice do grupo não vazio que contém a posição.
+ */
+
+static int grupoDaPosicao(const MapaCompacto *m, int i) {
+
+    // Último g com inicioGrupo[g] <= i
+    int baixo = 0, alto = m -> numGrupos - 1;
+    while (baixo < alto) {
+        int meio = baixo + (alto - baixo + 1) / 2;
+        if (m -> inicioGrupo[meio] <= i) baixo = meio;
+        else alto = meio - 1;
+    }
+
+    return baixo;
+
+}
+
+/**
+ * @brief Coordenada X relativa da antena numa posição, em qualquer dos modos.
+ *
+ * @param m Mapa compacto.
+ * @param i Posição.
+ * @return Coordenada relativa ao canto do retângulo.
+ */
+
+static uint64_t coordenadaX(const MapaCompacto *m, int i) {
+
+    return m -> estreito ? m -> x16[i] : m -> x32[i];
+
+}
+
+/**
+ * @brief Coordenada Y relativa da antena numa posição, em qualquer dos modos.
+ *
+ * @param m Mapa compacto.
+ * @param i Posição.
+ * @return Coordenada relativa ao canto do retângulo.
+ */
+
+static uint64_t coordenadaY(const MapaCompacto *m, int i) {
+
+    return m -> estreito ? m -> y16[i] : m -> y32[i];
+
+}
+
+/**
+ * @brief Constrói a cópia compacta das antenas.
+ *
+ * O retângulo coberto é o mapa [0, linhas) x [0, colunas), alargado para incluir
+ * antenas que estejam fora dele (por exemplo, inseridas depois do carregamento).
+ * As coordenadas ficam em 16 bits se esse retângulo couber em
+ * EXTENSAO_ESTREITA x EXTENSAO_ESTREITA células.
+ *
+ * @param lista Lista ligada de antenas.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @return Mapa compacto, ou false em caso de falha de memória.
+ */
+
+MapaCompacto *construirMapaCompacto(Antena *lista, int linhas, int colunas) {
+
+    MapaCompacto *m = (MapaCompacto *)calloc(1, sizeof(MapaCompacto));
+    if (!m) {
+        return false;
+    }
+
+    long long minX = 0, minY = 0;
+    long long maxX = linhas > 0 ? linhas - 1 : 0, maxY = colunas > 0 ? colunas - 1 : 0;
+    int n = 0;
+    for (Antena *a = lista; a; a = a -> proximo) {
+        n++;
+        if (a -> x < minX) minX = a -> x;
+        if (a -> x > maxX) maxX = a -> x;
+        if (a -> y < minY) minY = a -> y;
+        if (a -> y > maxY) maxY = a -> y;
+    }
+
+    // Origem par: a paridade das coordenadas relativas é a das absolutas
+    minX = parAbaixo(minX);
+    minY = parAbaixo(minY);
+
+    m -> numAntenas = n;
+    m -> origemX = (int)minX;
+    m -> origemY = (int)minY;
+    m -> extensaoX = maxX - minX + 1;
+    m -> extensaoY = maxY - minY + 1;
+    m -> estreito = maxX - minX < EXTENSAO_ESTREITA && maxY - minY < EXTENSAO_ESTREITA;
+    m -> numGrupos = (numFrequencias() > 0 ? numFrequencias() : 1) * PARIDADES_COMPACTO;
+    m -> inicioGrupo = (int *)calloc(m -> numGrupos + 1, sizeof(int));
+
+    size_t tamanho = n > 0 ? (size_t)n : 1;
+    if (m -> estreito) {
+        m -> x16 = (uint16_t *)malloc(tamanho * sizeof(uint16_t));
+        m -> y16 = (uint16_t *)malloc(tamanho * sizeof(uint16_t));
+    } else {
+        m -> x32 = (uint32_t *)malloc(tamanho * sizeof(uint32_t));
+        m -> y32 = (uint32_t *)malloc(tamanho * sizeof(uint32_t));
+    }
+    int *posicao = (int *)malloc(m -> numGrupos * sizeof(int));
+
+    if (!m -> inicioGrupo || !posicao || (m -> estreito ? !m -> x16 || !m -> y16 : !m -> x32 || !m -> y32)) {
+        free(posicao);
+        return libertarMapaCompacto(m);
+    }
+
+    // Ordenação por contagem (estável) pela chave de grupo
+    for (Antena *a = lista; a; a = a -> proximo) {
+        m -> inicioGrupo[a -> frequencia * PARIDADES_COMPACTO + (a -> x & 1) * 2 + (a -> y & 1) + 1]++;
+    }
+    for (int g = 0; g < m -> numGrupos; g++) {
+        m -> inicioGrupo[g + 1] += m -> inicioGrupo[g];
+        posicao[g] = m -> inicioGrupo[g];
+    }
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+        int p = posicao[a -> frequencia * PARIDADES_COMPACTO + (a -> x & 1) * 2 + (a -> y & 1)]++;
+        if (m -> estreito) {
+            m -> x16[p] = (uint16_t)(a -> x - minX);
+            m -> y16[p] = (uint16_t)(a -> y - minY);
+        } else {
+            m -> x32[p] = (uint32_t)(a -> x - minX);
+            m -> y32[p] = (uint32_t)(a -> y - minY);
+        }
+    }
+
+    free(posicao);
+
+    return m;
+
+}
+
+/**
+ * @brief Memória ocupada pelo mapa compacto.
+ *
+ * @param m Mapa compacto.
+ * @return Número de bytes reservados (sem o cabeçalho do malloc).
+ */
+
+size_t bytesMapaCompacto(const MapaCompacto *m) {
+
+    if (!m) {
+        return 0;
+    }
+
+    size_t porAntena = m -> estreito ? 2 * sizeof(uint16_t) : 2 * sizeof(uint32_t);
+
+    return sizeof(MapaCompacto) + (size_t)m -> numAntenas * porAntena + (size_t)(m -> numGrupos + 1) * sizeof(int);
+
+}
+
+/**
+ * @brief Marca os pontos médios dos pares cuja primeira antena está em [inicio, fim).
+ *
+ * @param inicio Primeira posição.
+ * @param fim Posição a seguir à última.
+ * @param arg Estado partilhado (EstadoCompacto).
+ */
+
+static void marcarIntervalo(int inicio, int fim, void *arg) {
+
+    EstadoCompacto *e = (EstadoCompacto *)arg;
+    const MapaCompacto *m = e -> m;
+    uint64_t largura = (uint64_t)m -> extensaoY;
+    int g = grupoDaPosicao(m, inicio);
+
+    for (int i = inicio; i < fim; i++) {
+
+        while (m -> inicioGrupo[g + 1] <= i) g++;
+        int fimGrupo = m -> inicioGrupo[g + 1];
+
+        if (m -> estreito) {
+
+            const uint16_t *xs = m -> x16, *ys = m -> y16;
+            uint32_t xi = xs[i], yi = ys[i];
+            for (int j = i + 1; j < fimGrupo; j++) {
+                uint64_t celula = (uint64_t)((xi + xs[j]) >> 1) * largura + ((yi + ys[j]) >> 1);
+                atomic_fetch_or_explicit(&e -> marcados[celula >> 6], (uint64_t)1 << (celula & 63), memory_order_relaxed);
+            }
+
+        } else {
+
+            const uint32_t *xs = m -> x32, *ys = m -> y32;
+            uint64_t xi = xs[i], yi = ys[i];
+            for (int j = i + 1; j < fimGrupo; j++) {
+                uint64_t celula = ((xi + xs[j]) >> 1) * largura + ((yi + ys[j]) >> 1);
+                atomic_fetch_or_explicit(&e -> marcados[celula >> 6], (uint64_t)1 << (celula & 63), memory_order_relaxed);
+            }
+
+        }
+
+    }
+
+}
+
+/**
+ * @brief Compara duas células codificadas, para `qsort`.
+ *
+ * @param a Primeira célula.
+ * @param b Segunda célula.
+ * @return Negativo, zero ou positivo.
+ */
+
+static int compararCelulas(const void *a, const void *b) {
+
+    uint64_t p = *(const uint64_t *)a, q = *(const uint64_t *)b;
+
+    return (p > q) - (p < q);
+
+}
+
+/**
+ * @brief Junta numa lista as células nefastas, sem mapa de bits (retângulos enormes).
+ *
+ * @param m Mapa compacto.
+ * @param quantidade Número de células devolvidas (-1 em caso de falha de memória).
+ * @return Vetor ordenado e sem repetidos das células, ou NULL (vazio ou falha de memória).
+ */
+
+static uint64_t *juntarCelulas(const MapaCompacto *m, long *quantidade) {
+
+    long capacidade = 1024, total = 0;
+    uint64_t *celulas = (uint64_t *)malloc(capacidade * sizeof(uint64_t));
+    uint64_t largura = (uint64_t)m -> extensaoY;
+    *quantidade = 0;
+
+    for (int g = 0; g < m -> numGrupos && celulas; g++) {
+        for (int i = m -> inicioGrupo[g]; i < m -> inicioGrupo[g + 1] && celulas; i++) {
+            for (int j = i + 1; j < m -> inicioGrupo[g + 1]; j++) {
+
+                if (total == capacidade) {
+                    uint64_t *maior = (uint64_t *)realloc(celulas, 2 * capacidade * sizeof(uint64_t));
+                    if (!maior) {
+                        free(celulas);
+                        celulas = NULL;
+                        break;
+                    }
+                    celulas = maior;
+                    capacidade *= 2;
+                }
+
+                uint64_t mx = (coordenadaX(m, i) + coordenadaX(m, j)) >> 1;
+                uint64_t my = (coordenadaY(m, i) + coordenadaY(m, j)) >> 1;
+                celulas[total++] = mx * largura + my;
+
+            }
+        }
+    }
+
+    if (!celulas || total == 0) {
+        if (!celulas) *quantidade = -1;
+        free(celulas);
+        return NULL;
+    }
+
+    // Radix em tempo linear; o qsort fica só para a falta de memória auxiliar
+    if (!ordenarChaves(celulas, total)) {
+        qsort(celulas, total, sizeof(uint64_t), compararCelulas);
+    }
+
+    long distintas = 0;
+    for (long k = 0; k < total; k++) {
+        if (k == 0 || celulas[k] != celulas[distintas - 1]) celulas[distintas++] = celulas[k];
+    }
+    *quantidade = distintas;
+
+    return celulas;
+
+}
+
+/**
+ * @brief Acrescenta uma célula do retângulo ao início de uma lista de coordenadas.
+ *
+ * @param m Mapa compacto.
+ * @param lista Lista atual.
+ * @param celula Célula codificada (linha * extensaoY + coluna, relativas).
+ * @return Nova cabeça da lista, ou NULL se a alocação falhar.
+ */
+
+static Coordenada *anteporCelula(const MapaCompacto *m, Coordenada *lista, uint64_t celula) {
+
+    Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+    if (!nova) {
+        return NULL;
+    }
+    INSTR_CONTAR(CONTADOR_ALOC_COORDENADA, 1);
+
+    nova -> x = (int)((long long)(celula / (uint64_t)m -> extensaoY) + m -> origemX);
+    nova -> y = (int)((long long)(celula % (uint64_t)m -> extensaoY) + m -> origemY);
+    nova -> proximo = lista;
+
+    return nova;
+
+}
+
+/**
+ * @brief Detecta os locais nefastos a partir do mapa compacto.
+ *
+ * Produz o mesmo conjunto que `detectarLocaisNefastos`, ordenado por (x, y).
+ *
+ * @param m Mapa compacto.
+ * @param pool Conjunto de threads (NULL executa na thread atual).
+ * @return Lista de coordenadas com efeito nefasto, ou false em caso de falha de memória.
+ */
+
+Coordenada *detectarNefastosCompacto(const MapaCompacto *m, PoolTarefas *pool) {
+
+    if (!m || m -> numAntenas < 2) {
+        return NULL;
+    }
+
+    Coordenada *nefastos = NULL;
+
+    // Comparação por divisão: o produto das extensões pode exceder 64 bits com sinal
+    if (m -> extensaoX > LIMITE_CELULAS_COMPACTO / m -> extensaoY) {
+
+        long quantidade;
+        uint64_t *celulas = juntarCelulas(m, &quantidade);
+        if (quantidade < 0) {
+            return false;
+        }
+
+        for (long k = quantidade - 1; k >= 0; k--) {
+            Coordenada *nova = anteporCelula(m, nefastos, celulas[k]);
+            if (!nova) {
+                free(celulas);
+                return libertarCoordenadas(nefastos);
+            }
+            nefastos = nova;
+        }
+        free(celulas);
+
+        return nefastos;
+
+    }
+
+    long long area = m -> extensaoX * m -> extensaoY;
+    EstadoCompacto e;
+    e.m = m;
+    e.marcados = (_Atomic uint64_t *)calloc((size_t)((area + 63) / 64), sizeof(uint64_t));
+    if (!e.marcados) {
+        return NULL;
+    }
+
+    paraleloPara(pool, 0, m -> numAntenas, GRAO_COMPACTO, marcarIntervalo, &e);
+
+    // Percorre as células de trás para a frente para a lista ficar por ordem crescente
+    for (long long p = (area + 63) / 64 - 1; p >= 0; p--) {
+
+        uint64_t bits = e.marcados[p];
+
+        while (bits) {
+
+            int b = 63 - __builtin_clzll(bits);
+            bits &= ~((uint64_t)1 << b);
+
+            Coordenada *nova = anteporCelula(m, nefastos, (uint64_t)p * 64 + b);
+            if (!nova) {
+                free((void *)e.marcados);
+                return libertarCoordenadas(nefastos);
+            }
+            nefastos = nova;
+
+        }
+
+    }
+
+    free((void *)e.marcados);
+
+    return nefastos;
+
+}
+
+/**
+ * @brief Liberta toda a memória associada ao mapa compacto.
+ *
+ * @param m Mapa compacto.
+ * @return false após a libertação completa.
+ */
+
+MapaCompacto *libertarMapaCompacto(MapaCompacto *m) {
+
+    if (!m) {
+        return false;
+    }
+
+    free(m -> x16);
+    free(m -> y16);
+    free(m -> x32);
+    free(m -> y32);
+    free(m -> inicioGrupo);
+    free(m);
+
+    return false;
+
+}
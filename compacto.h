@@ -0,0 +1,67 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file compacto.h
+ * @author Thiago Abreu
+ * @brief Cópia compacta das antenas em vetores contíguos, com coordenadas de 16 bits.
+ *
+ * Cada antena da lista ligada ocupa 24 bytes mais o cabeçalho do malloc. A forma
+ * compacta guarda só as coordenadas, relativas ao canto do retângulo que contém o
+ * mapa e todas as antenas, em dois vetores de `uint16_t` (4 bytes por antena) quando
+ * esse retângulo não passa de 65536 x 65536 células, ou de `uint32_t` caso contrário.
+ * O modo é escolhido na construção a partir de `linhas`/`colunas`.
+ *
+ * As antenas ficam agrupadas por frequência e, dentro de cada frequência, pela
+ * paridade de (x, y): dois pontos têm ponto médio inteiro exatamente quando têm a
+ * mesma paridade, pelo que o núcleo dos locais nefastos só percorre pares do mesmo
+ * grupo e não precisa de testar nada dentro do ciclo.
+ */
+
+#ifndef COMPACTO_H
+#define COMPACTO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "antenas.h"
+#include "tarefas.h"
+
+/** Maior extensão (em células) que cabe em coordenadas de 16 bits. */
+#define EXTENSAO_ESTREITA 65536
+
+/** Grupos por frequência: um por classe de paridade de (x, y). */
+#define PARIDADES_COMPACTO 4
+
+/**
+ * @struct MapaCompacto
+ * @brief Antenas em vetores contíguos, agrupadas por (frequência, paridade).
+ *
+ * O grupo `g = frequencia * PARIDADES_COMPACTO + (x & 1) * 2 + (y & 1)` ocupa as
+ * posições `inicioGrupo[g]` até `inicioGrupo[g + 1] - 1`. A antena na posição `i`
+ * está em (origemX + x16[i], origemY + y16[i]) no modo estreito, ou em
+ * (origemX + x32[i], origemY + y32[i]) no modo largo.
+ */
+
+typedef struct MapaCompacto {
+    int numAntenas;          /**< Número de antenas */
+    bool estreito;           /**< true se as coordenadas estão em 16 bits */
+    int origemX, origemY;    /**< Canto do retângulo coberto (par, para manter a paridade) */
+    long long extensaoX;     /**< Linhas do retângulo coberto */
+    long long extensaoY;     /**< Colunas do retângulo coberto */
+    uint16_t *x16, *y16;     /**< Coordenadas relativas (modo estreito) */
+    uint32_t *x32, *y32;     /**< Coordenadas relativas (modo largo) */
+    int numGrupos;           /**< numFrequencias() * PARIDADES_COMPACTO na construção */
+    int *inicioGrupo;        /**< Início de cada grupo (numGrupos + 1 entradas) */
+} MapaCompacto;
+
+MapaCompacto *construirMapaCompacto(Antena *lista, int linhas, int colunas);
+size_t bytesMapaCompacto(const MapaCompacto *m);
+Coordenada *detectarNefastosCompacto(const MapaCompacto *m, PoolTarefas *pool);
+MapaCompacto *libertarMapaCompacto(MapaCompacto *m);
+
+#endif
@@ -0,0 +1,306 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file densidade.c
+ * @author Thiago Abreu
+ * @brief Construção e consulta da grelha de densidade de interferência.
+ *
+ * As contagens são preenchidas pela regra de `detectarLocaisNefastos` (ponto médio
+ * de cada par da mesma frequência com diferenças pares), com as antenas agrupadas
+ * por frequência. Pontos fora do mapa não são contados.
+ *
+ * O total de um retângulo sai da combinação de quatro somas acumuladas. Para o
+ * máximo, um índice O(1) em duas dimensões exigiria O(área x log² área) de memória;
+ * a tabela esparsa por linha fica em O(área x log colunas) e responde em
+ * O(altura), com uma consulta O(1) por linha.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "densidade.h"
+
+/**
+ * @brief Índice de uma célula nas matrizes de linhas x colunas.
+ */
+
+#define CELULA(g, x, y) ((size_t)(x) * (size_t)(g) -> colunas + (size_t)(y))
+
+/**
+ * @brief Índice de uma posição na tabela de somas, com uma linha e coluna extra.
+ */
+
+#define SOMA(g, x, y) ((size_t)(x) * ((size_t)(g) -> colunas + 1) + (size_t)(y))
+
+/**
+ * @brief Maior k tal que 2^k <= n (n > 0).
+ *
+ * @param n Valor positivo.
+ * @return Logaritmo de base 2, arredondado para baixo.
+ */
+
+static int log2Inteiro(int n) {
+
+    int k = 0;
+    while ((1 << (k + 1)) <= n) k++;
+
+    return k;
+
+}
+
+/**
+ * @brief Coluna com a maior contagem na janela [y, y + 2^nivel) da linha x.
+ *
+ * @param g Grelha.
+ * @param nivel Nível da tabela esparsa.
+ * @param x Linha.
+ * @param y Primeira coluna da janela.
+ * @return Coluna do máximo.
+ */
+
+static int colunaMaxima(const GrelhaInterferencia *g, int nivel, int x, int y) {
+
+    if (nivel == 0) {
+        return y;
+    }
+
+    return g -> esparsa[(size_t)(nivel - 1) * g -> linhas * g -> colunas + CELULA(g, x, y)];
+
+}
+
+/**
+ * @brief Constrói a grelha de contagens, as somas acumuladas e a tabela esparsa.
+ *
+ * @param lista Lista ligada de antenas.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @return Grelha construída, ou false em caso de dimensões inválidas ou falha de memória.
+ */
+
+GrelhaInterferencia *construirGrelhaInterferencia(Antena *lista, int linhas, int colunas) {
+
+    if (linhas <= 0 || colunas <= 0) {
+        return false;
+    }
+
+    GrelhaInterferencia *g = (GrelhaInterferencia *)calloc(1, sizeof(GrelhaInterferencia));
+    if (!g) {
+        return false;
+    }
+
+    size_t area = (size_t)linhas * colunas;
+    g -> linhas = linhas;
+    g -> colunas = colunas;
+    g -> niveis = log2Inteiro(colunas);
+    g -> contagem = (int *)calloc(area, sizeof(int));
+    g -> somas = (long long *)calloc(((size_t)linhas + 1) * ((size_t)colunas + 1), sizeof(long long));
+    g -> esparsa = (int *)malloc((g -> niveis > 0 ? (size_t)g -> niveis * area : 1) * sizeof(int));
+
+    // Antenas agrupadas por frequência (ordenação por contagem)
+    int n = 0;
+    int nf = numFrequencias();
+    int *inicio = (int *)calloc(nf + 1, sizeof(int));
+    int *posicao = (int *)malloc((nf > 0 ? nf : 1) * sizeof(int));
+    for (Antena *a = lista; inicio && a; a = a -> proximo) {
+        n++;
+        inicio[a -> frequencia + 1]++;
+    }
+    Antena **grupos = (Antena **)malloc((n > 0 ? n : 1) * sizeof(Antena *));
+
+    if (!g -> contagem || !g -> somas || !g -> esparsa || !inicio || !posicao || !grupos) {
+        free(inicio);
+        free(posicao);
+        free(grupos);
+        return libertarGrelhaInterferencia(g);
+    }
+
+    for (int f = 0; f < nf; f++) inicio[f + 1] += inicio[f];
+    memcpy(posicao, inicio, nf * sizeof(int));
+    for (Antena *a = lista; a; a = a -> proximo) {
+        grupos[posicao[a -> frequencia]++] = a;
+    }
+
+    for (int f = 0; f < nf; f++) {
+        for (int p = inicio[f]; p < inicio[f + 1]; p++) {
+            for (int q = p + 1; q < inicio[f + 1]; q++) {
+
+                int dx = grupos[q] -> x - grupos[p] -> x;
+                int dy = grupos[q] -> y - grupos[p] -> y;
+                if (dx % 2 != 0 || dy % 2 != 0) continue;
+
+                int mx = grupos[p] -> x + dx / 2;
+                int my = grupos[p] -> y + dy / 2;
+                if (mx >= 0 && mx < linhas && my >= 0 && my < colunas) {
+                    g -> contagem[CELULA(g, mx, my)]++;
+                }
+
+            }
+        }
+    }
+    free(inicio);
+    free(posicao);
+    free(grupos);
+
+    // Somas acumuladas: somas[x + 1][y + 1] é o total de [0, x] x [0, y]
+    for (int x = 0; x < linhas; x++) {
+        long long linha = 0;
+        for (int y = 0; y < colunas; y++) {
+            linha += g -> contagem[CELULA(g, x, y)];
+            g -> somas[SOMA(g, x + 1, y + 1)] = g -> somas[SOMA(g, x, y + 1)] + linha;
+        }
+    }
+
+    // Tabela esparsa por linha: o nível k combina duas janelas do nível k - 1
+    for (int k = 1; k <= g -> niveis; k++) {
+        int *nivel = g -> esparsa + (size_t)(k - 1) * area;
+        int metade = 1 << (k - 1);
+        for (int x = 0; x < linhas; x++) {
+            for (int y = 0; y + (1 << k) <= colunas; y++) {
+                int a = colunaMaxima(g, k - 1, x, y);
+                int b = colunaMaxima(g, k - 1, x, y + metade);
+                nivel[CELULA(g, x, y)] = g -> contagem[CELULA(g, x, b)] > g -> contagem[CELULA(g, x, a)] ? b : a;
+            }
+        }
+    }
+
+    return g;
+
+}
+
+/**
+ * @brief Número de pares que atingem uma célula.
+ *
+ * @param g Grelha.
+ * @param x Linha.
+ * @param y Coluna.
+ * @return Contagem da célula, ou 0 se estiver fora do mapa.
+ */
+
+int contagemCelula(const GrelhaInterferencia *g, int x, int y) {
+
+    if (!g || x < 0 || x >= g -> linhas || y < 0 || y >= g -> colunas) {
+        return 0;
+    }
+
+    return g -> contagem[CELULA(g, x, y)];
+
+}
+
+/**
+ * @brief Ordena os cantos de um retângulo e recorta-o aos limites do mapa.
+ *
+ * @param g Grelha.
+ * @param x1 Primeira linha (atualizada).
+ * @param y1 Primeira coluna (atualizada).
+ * @param x2 Última linha (atualizada).
+ * @param y2 Última coluna (atualizada).
+ * @return true se o retângulo recortado não for vazio.
+ */
+
+static bool recortar(const GrelhaInterferencia *g, int *x1, int *y1, int *x2, int *y2) {
+
+    if (*x1 > *x2) { int t = *x1; *x1 = *x2; *x2 = t; }
+    if (*y1 > *y2) { int t = *y1; *y1 = *y2; *y2 = t; }
+
+    if (*x1 < 0) *x1 = 0;
+    if (*y1 < 0) *y1 = 0;
+    if (*x2 >= g -> linhas) *x2 = g -> linhas - 1;
+    if (*y2 >= g -> colunas) *y2 = g -> colunas - 1;
+
+    return *x1 <= *x2 && *y1 <= *y2;
+
+}
+
+/**
+ * @brief Total de pares sobre as células de um retângulo, em O(1).
+ *
+ * @param g Grelha.
+ * @param x1 Primeira linha (inclusive).
+ * @param y1 Primeira coluna (inclusive).
+ * @param x2 Última linha (inclusive).
+ * @param y2 Última coluna (inclusive).
+ * @return Soma das contagens do retângulo recortado ao mapa.
+ */
+
+long long totalRetangulo(const GrelhaInterferencia *g, int x1, int y1, int x2, int y2) {
+
+    if (!g || !recortar(g, &x1, &y1, &x2, &y2)) {
+        return 0;
+    }
+
+    return g -> somas[SOMA(g, x2 + 1, y2 + 1)] - g -> somas[SOMA(g, x1, y2 + 1)]
+         - g -> somas[SOMA(g, x2 + 1, y1)] + g -> somas[SOMA(g, x1, y1)];
+
+}
+
+/**
+ * @brief Célula mais atingida de um retângulo, em O(altura do retângulo).
+ *
+ * Em caso de empate devolve a primeira célula por ordem (x, y).
+ *
+ * @param g Grelha.
+ * @param x1 Primeira linha (inclusive).
+ * @param y1 Primeira coluna (inclusive).
+ * @param x2 Última linha (inclusive).
+ * @param y2 Última coluna (inclusive).
+ * @param mx Recebe a linha da célula (pode ser NULL).
+ * @param my Recebe a coluna da célula (pode ser NULL).
+ * @return Contagem máxima, ou -1 se o retângulo não intersectar o mapa.
+ */
+
+int maximoRetangulo(const GrelhaInterferencia *g, int x1, int y1, int x2, int y2, int *mx, int *my) {
+
+    if (!g || !recortar(g, &x1, &y1, &x2, &y2)) {
+        return -1;
+    }
+
+    int k = log2Inteiro(y2 - y1 + 1);
+    int melhor = -1, bx = x1, by = y1;
+
+    for (int x = x1; x <= x2; x++) {
+
+        int a = colunaMaxima(g, k, x, y1);
+        int b = colunaMaxima(g, k, x, y2 - (1 << k) + 1);
+        int y = g -> contagem[CELULA(g, x, b)] > g -> contagem[CELULA(g, x, a)] ? b : a;
+
+        if (g -> contagem[CELULA(g, x, y)] > melhor) {
+            melhor = g -> contagem[CELULA(g, x, y)];
+            bx = x;
+            by = y;
+        }
+
+    }
+
+    if (mx) *mx = bx;
+    if (my) *my = by;
+
+    return melhor;
+
+}
+
+/**
+ * @brief Liberta toda a memória associada à grelha.
+ *
+ * @param g Grelha.
+ * @return false após a libertação completa.
+ */
+
+GrelhaInterferencia *libertarGrelhaInterferencia(GrelhaInterferencia *g) {
+
+    if (!g) {
+        return false;
+    }
+
+    free(g -> contagem);
+    free(g -> somas);
+    free(g -> esparsa);
+    free(g);
+
+    return false;
+
+}
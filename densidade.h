@@ -0,0 +1,44 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file densidade.h
+ * @author Thiago Abreu
+ * @brief Grelha de densidade de interferência com consultas por retângulo.
+ *
+ * Cada célula do mapa guarda quantos pares de antenas a tornam nefasta. Sobre a
+ * grelha é construída uma tabela de somas acumuladas (summed-area table), que dá o
+ * total de qualquer retângulo em O(1), e uma tabela esparsa por linha, que dá a
+ * célula mais atingida de um retângulo em O(altura do retângulo).
+ */
+
+#ifndef DENSIDADE_H
+#define DENSIDADE_H
+
+#include "antenas.h"
+
+/**
+ * @struct GrelhaInterferencia
+ * @brief Contagens por célula e estruturas auxiliares das consultas.
+ */
+
+typedef struct GrelhaInterferencia {
+    int linhas, colunas;   /**< Dimensões do mapa */
+    int *contagem;         /**< Pares que atingem cada célula (linhas x colunas) */
+    long long *somas;      /**< Somas acumuladas ((linhas + 1) x (colunas + 1)) */
+    int niveis;            /**< Níveis da tabela esparsa (além do nível 0, implícito) */
+    int *esparsa;          /**< Para cada nível k >= 1, coluna do máximo de cada janela de 2^k células */
+} GrelhaInterferencia;
+
+GrelhaInterferencia *construirGrelhaInterferencia(Antena *lista, int linhas, int colunas);
+int contagemCelula(const GrelhaInterferencia *g, int x, int y);
+long long totalRetangulo(const GrelhaInterferencia *g, int x1, int y1, int x2, int y2);
+int maximoRetangulo(const GrelhaInterferencia *g, int x1, int y1, int x2, int y2, int *mx, int *my);
+GrelhaInterferencia *libertarGrelhaInterferencia(GrelhaInterferencia *g);
+
+#endif
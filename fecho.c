@@ -0,0 +1,381 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file fecho.c
+ * @author Thiago Abreu
+ * @brief Implementação do fecho transitivo por componentes.
+ *
+ * As componentes vêm de uma floresta de conjuntos disjuntos sobre os arcos e as
+ * componentes fortes do algoritmo de Tarjan (iterativo, com pilha explícita).
+ * Tarjan fecha cada componente forte depois de todas as que ela alcança, pelo
+ * que, percorrendo-as pela ordem de fecho, a linha de cada uma é a união da
+ * sua própria com as linhas (já completas) dos sucessores: 64 vértices por
+ * operação em vez de uma procura por par.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fecho.h"
+
+/**
+ * @brief Representante do conjunto de um vértice, com compressão de caminho a meias.
+ *
+ * @param pai Floresta de conjuntos disjuntos.
+ * @param v Vértice.
+ * @return Representante do conjunto.
+ */
+
+static int representante(int *pai, int v) {
+
+    while (pai[v] != v) {
+        pai[v] = pai[pai[v]];
+        v = pai[v];
+    }
+
+    return v;
+
+}
+
+/**
+ * @brief Calcula as componentes fortemente ligadas (Tarjan iterativo).
+ *
+ * @param g Grafo compacto.
+ * @param forte Componente forte de cada vértice (saída), numerada pela ordem de fecho.
+ * @return Número de componentes fortes, ou -1 em caso de falha de memória.
+ */
+
+static int componentesFortes(const GrafoCSR *g, int *forte) {
+
+    int n = g -> numVertices;
+    int *ordem = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *baixo = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *pilha = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *chamadas = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *proxima = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+
+    if (!ordem || !baixo || !pilha || !chamadas || !proxima) {
+        free(ordem);
+        free(baixo);
+        free(pilha);
+        free(chamadas);
+        free(proxima);
+        return -1;
+    }
+
+    // forte[v] == -1 enquanto v não tiver componente; ordem[v] == -1 enquanto não for visitado
+    for (int v = 0; v < n; v++) {
+        ordem[v] = -1;
+        forte[v] = -1;
+    }
+
+    int contador = 0, topoPilha = 0, numFortes = 0;
+
+    for (int raiz = 0; raiz < n; raiz++) {
+
+        if (ordem[raiz] >= 0) continue;
+
+        int topo = 0;
+        chamadas[0] = raiz;
+        proxima[0] = g -> inicioArestas[raiz];
+        ordem[raiz] = baixo[raiz] = contador++;
+        pilha[topoPilha++] = raiz;
+
+        while (topo >= 0) {
+
+            int v = chamadas[topo];
+
+            if (proxima[topo] < g -> inicioArestas[v + 1]) {
+
+                int w = g -> destinos[proxima[topo]++];
+
+                if (ordem[w] < 0) {
+                    // Desce para w
+                    ordem[w] = baixo[w] = contador++;
+                    pilha[topoPilha++] = w;
+                    topo++;
+                    chamadas[topo] = w;
+                    proxima[topo] = g -> inicioArestas[w];
+                } else if (forte[w] < 0 && ordem[w] < baixo[v]) {
+                    // w ainda está na pilha
+                    baixo[v] = ordem[w];
+                }
+                continue;
+
+            }
+
+            // Todos os arcos de v vistos: fecha a componente se v for a sua raiz
+            if (baixo[v] == ordem[v]) {
+                int w;
+                do {
+                    w = pilha[--topoPilha];
+                    forte[w] = numFortes;
+                } while (w != v);
+                numFortes++;
+            }
+
+            topo--;
+            if (topo >= 0) {
+                int u = chamadas[topo];
+                if (baixo[v] < baixo[u]) baixo[u] = baixo[v];
+            }
+
+        }
+
+    }
+
+    free(ordem);
+    free(baixo);
+    free(pilha);
+    free(chamadas);
+    free(proxima);
+
+    return numFortes;
+
+}
+
+/**
+ * @brief Constrói o fecho transitivo do grafo, limitado a um orçamento de memória.
+ *
+ * Antes de reservar os bits, calcula a memória de cada componente (linhas x
+ * palavras x 8 bytes); as que não cabem no que resta do orçamento são recusadas.
+ * `bytesNecessarios` indica quanto seria preciso para não recusar nenhuma.
+ *
+ * @param g Grafo compacto (os arcos são tratados como dirigidos).
+ * @param orcamento Máximo de bytes para as linhas de alcance.
+ * @return Fecho construído, ou false em caso de falha de memória.
+ */
+
+FechoTransitivo *construirFecho(const GrafoCSR *g, size_t orcamento) {
+
+    if (!g) {
+        return false;
+    }
+
+    FechoTransitivo *f = (FechoTransitivo *)calloc(1, sizeof(FechoTransitivo));
+    if (!f) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    int m = n > 0 ? n : 1;
+    f -> numVertices = n;
+    f -> componente = (int *)malloc(m * sizeof(int));
+    f -> posicaoLocal = (int *)malloc(m * sizeof(int));
+    f -> forte = (int *)malloc(m * sizeof(int));
+    int *pai = (int *)malloc(m * sizeof(int));
+
+    if (!f -> componente || !f -> posicaoLocal || !f -> forte || !pai) {
+        free(pai);
+        return libertarFecho(f);
+    }
+
+    // Componentes, ignorando o sentido dos arcos
+    for (int v = 0; v < n; v++) pai[v] = v;
+    for (int v = 0; v < n; v++) {
+        for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+            int a = representante(pai, v), b = representante(pai, g -> destinos[k]);
+            if (a != b) pai[a] = b;
+        }
+    }
+
+    // Numera as componentes pela ordem do primeiro vértice
+    int *numero = (int *)malloc(m * sizeof(int));
+    if (!numero) {
+        free(pai);
+        return libertarFecho(f);
+    }
+    int numComponentes = 0;
+    for (int v = 0; v < n; v++) numero[v] = -1;
+    for (int v = 0; v < n; v++) {
+        int r = representante(pai, v);
+        if (numero[r] < 0) numero[r] = numComponentes++;
+        f -> componente[v] = numero[r];
+    }
+    free(numero);
+    f -> numComponentes = numComponentes;
+
+    // A floresta já não é precisa: o vetor passa a guardar o tamanho de cada componente
+    int *tamanho = pai;
+    int c = numComponentes > 0 ? numComponentes : 1;
+    memset(tamanho, 0, m * sizeof(int));
+    for (int v = 0; v < n; v++) {
+        f -> posicaoLocal[v] = tamanho[f -> componente[v]]++;
+    }
+
+    f -> fortesComponente = (int *)calloc(c, sizeof(int));
+    f -> palavrasComponente = (int *)malloc(c * sizeof(int));
+    f -> inicioComponente = (long long *)malloc(c * sizeof(long long));
+
+    if (!f -> fortesComponente || !f -> palavrasComponente || !f -> inicioComponente) {
+        free(pai);
+        return libertarFecho(f);
+    }
+
+    f -> numFortes = componentesFortes(g, f -> forte);
+    f -> linhaForte = (int *)malloc((f -> numFortes > 0 ? f -> numFortes : 1) * sizeof(int));
+    if (f -> numFortes < 0 || !f -> linhaForte) {
+        free(pai);
+        return libertarFecho(f);
+    }
+
+    // Membros de cada componente forte, pela ordem de fecho (ordenação por contagem)
+    int s = f -> numFortes;
+    int *inicioMembros = (int *)calloc(s + 1, sizeof(int));
+    int *membros = (int *)malloc(m * sizeof(int));
+    int *marca = (int *)malloc((s > 0 ? s : 1) * sizeof(int));
+
+    if (!inicioMembros || !membros || !marca) {
+        free(pai);
+        free(inicioMembros);
+        free(membros);
+        free(marca);
+        return libertarFecho(f);
+    }
+
+    for (int v = 0; v < n; v++) inicioMembros[f -> forte[v] + 1]++;
+    for (int i = 0; i < s; i++) inicioMembros[i + 1] += inicioMembros[i];
+    for (int i = 0; i < s; i++) marca[i] = inicioMembros[i];
+    for (int v = 0; v < n; v++) membros[marca[f -> forte[v]]++] = v;
+
+    for (int i = 0; i < s; i++) {
+        int comp = f -> componente[membros[inicioMembros[i]]];
+        f -> linhaForte[i] = f -> fortesComponente[comp]++;
+    }
+
+    // Memória de cada componente, decidida antes de reservar
+    long long palavrasUsadas = 0;
+    for (int k = 0; k < numComponentes; k++) {
+
+        f -> palavrasComponente[k] = (tamanho[k] + 63) / 64;
+        size_t bytes = f -> fortesComponente[k] > 1
+                     ? (size_t)f -> fortesComponente[k] * f -> palavrasComponente[k] * sizeof(uint64_t) : 0;
+
+        f -> bytesNecessarios += bytes;
+
+        if (f -> bytesUsados + bytes <= orcamento) {
+            f -> inicioComponente[k] = palavrasUsadas;
+            palavrasUsadas += (long long)(bytes / sizeof(uint64_t));
+            f -> bytesUsados += bytes;
+        } else {
+            f -> inicioComponente[k] = -1;
+            f -> componentesRecusadas++;
+        }
+
+    }
+
+    free(pai);
+
+    f -> bits = (uint64_t *)calloc(palavrasUsadas > 0 ? palavrasUsadas : 1, sizeof(uint64_t));
+    if (!f -> bits) {
+        free(inicioMembros);
+        free(membros);
+        free(marca);
+        return libertarFecho(f);
+    }
+
+    // Linhas pela ordem de fecho: os sucessores de cada componente forte já estão completos
+    for (int i = 0; i < s; i++) marca[i] = -1;
+
+    for (int i = 0; i < s; i++) {
+
+        int comp = f -> componente[membros[inicioMembros[i]]];
+        if (f -> fortesComponente[comp] <= 1 || f -> inicioComponente[comp] < 0) continue;
+
+        int palavras = f -> palavrasComponente[comp];
+        uint64_t *linha = &f -> bits[f -> inicioComponente[comp] + (long long)f -> linhaForte[i] * palavras];
+
+        for (int j = inicioMembros[i]; j < inicioMembros[i + 1]; j++) {
+
+            int u = membros[j];
+            linha[f -> posicaoLocal[u] >> 6] |= (uint64_t)1 << (f -> posicaoLocal[u] & 63);
+
+            for (int k = g -> inicioArestas[u]; k < g -> inicioArestas[u + 1]; k++) {
+
+                int t = f -> forte[g -> destinos[k]];
+                if (t == i || marca[t] == i) continue;
+                marca[t] = i;
+
+                const uint64_t *sucessor = &f -> bits[f -> inicioComponente[comp] + (long long)f -> linhaForte[t] * palavras];
+                for (int w = 0; w < palavras; w++) linha[w] |= sucessor[w];
+
+            }
+
+        }
+
+    }
+
+    free(inicioMembros);
+    free(membros);
+    free(marca);
+
+    return f;
+
+}
+
+/**
+ * @brief Indica se o vértice v é alcançável a partir de u, em O(1).
+ *
+ * @param f Fecho transitivo.
+ * @param u Índice CSR da origem.
+ * @param v Índice CSR do destino.
+ * @return 1 se v é alcançável (incluindo u == v), 0 se não é, ou
+ *         ALCANCE_DESCONHECIDO se a componente foi recusada pelo orçamento.
+ */
+
+int alcancaFecho(const FechoTransitivo *f, int u, int v) {
+
+    if (!f || u < 0 || v < 0 || u >= f -> numVertices || v >= f -> numVertices) {
+        return 0;
+    }
+
+    int c = f -> componente[u];
+    if (c != f -> componente[v]) {
+        return 0;
+    }
+
+    if (f -> fortesComponente[c] <= 1) {
+        return 1;
+    }
+
+    if (f -> inicioComponente[c] < 0) {
+        return ALCANCE_DESCONHECIDO;
+    }
+
+    const uint64_t *linha = &f -> bits[f -> inicioComponente[c] + (long long)f -> linhaForte[f -> forte[u]] * f -> palavrasComponente[c]];
+    int p = f -> posicaoLocal[v];
+
+    return (int)((linha[p >> 6] >> (p & 63)) & 1);
+
+}
+
+/**
+ * @brief Liberta o fecho transitivo.
+ *
+ * @param f Fecho transitivo.
+ * @return false após a libertação.
+ */
+
+FechoTransitivo *libertarFecho(FechoTransitivo *f) {
+
+    if (!f) {
+        return false;
+    }
+
+    free(f -> componente);
+    free(f -> posicaoLocal);
+    free(f -> forte);
+    free(f -> linhaForte);
+    free(f -> fortesComponente);
+    free(f -> palavrasComponente);
+    free(f -> inicioComponente);
+    free(f -> bits);
+    free(f);
+
+    return false;
+
+}
@@ -0,0 +1,68 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file fecho.h
+ * @author Thiago Abreu
+ * @brief Fecho transitivo do grafo compacto: "v é alcançável a partir de u?" em O(1).
+ *
+ * O grafo é dividido em componentes (ligadas, ignorando o sentido dos arcos) e,
+ * dentro de cada uma, em componentes fortemente ligadas. Os vértices de uma
+ * componente forte alcançam exatamente os mesmos vértices, pelo que cada uma
+ * guarda uma única linha de bits com os vértices alcançáveis da sua componente.
+ * Uma componente com uma só componente forte (o caso de todo o grafo não
+ * dirigido) não precisa de bits nenhuns.
+ *
+ * A memória necessária é calculada antes de reservar os bits; as componentes que
+ * não cabem no orçamento ficam recusadas e as suas consultas respondem "desconhecido".
+ */
+
+#ifndef FECHO_H
+#define FECHO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "grafocsr.h"
+
+/** Orçamento de memória usado quando o chamador não indica outro (64 MB). */
+#define ORCAMENTO_FECHO_PADRAO ((size_t)64 << 20)
+
+/** Resposta de `alcancaFecho` para componentes recusadas pelo orçamento. */
+#define ALCANCE_DESCONHECIDO -1
+
+/**
+ * @struct FechoTransitivo
+ * @brief Linhas de alcance por componente forte, agrupadas por componente.
+ *
+ * A linha da componente forte `s`, da componente `c`, começa na palavra
+ * `inicioComponente[c] + linhaForte[s] * palavrasComponente[c]` de `bits`, e o
+ * vértice `v` da mesma componente corresponde ao bit `posicaoLocal[v]`.
+ */
+
+typedef struct FechoTransitivo {
+    int numVertices;           /**< Vértices do grafo */
+    int numComponentes;        /**< Componentes (sem considerar o sentido dos arcos) */
+    int numFortes;             /**< Componentes fortemente ligadas */
+    int *componente;           /**< Componente de cada vértice */
+    int *posicaoLocal;         /**< Posição de cada vértice dentro da sua componente */
+    int *forte;                /**< Componente forte de cada vértice */
+    int *linhaForte;           /**< Linha de cada componente forte dentro da sua componente */
+    int *fortesComponente;     /**< Número de componentes fortes de cada componente */
+    int *palavrasComponente;   /**< Palavras de 64 bits por linha em cada componente */
+    long long *inicioComponente; /**< Primeira palavra das linhas da componente (-1 se recusada) */
+    uint64_t *bits;            /**< Linhas de alcance */
+    size_t bytesNecessarios;   /**< Memória de bits que todas as componentes exigiriam */
+    size_t bytesUsados;        /**< Memória de bits efetivamente reservada */
+    int componentesRecusadas;  /**< Componentes que excederam o orçamento */
+} FechoTransitivo;
+
+FechoTransitivo *construirFecho(const GrafoCSR *g, size_t orcamento);
+int alcancaFecho(const FechoTransitivo *f, int u, int v);
+FechoTransitivo *libertarFecho(FechoTransitivo *f);
+
+#endif
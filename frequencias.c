@@ -0,0 +1,244 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file frequencias.c
+ * @author Thiago Abreu
+ * @brief Implementação do dicionário de frequências.
+ *
+ * Os nomes ficam num vetor indexado pelo identificador e uma tabela de dispersão
+ * aberta (FNV-1a, sondagem linear, carga <= 0.5) faz o caminho inverso. Os nomes
+ * de um só carácter, que são os lidos do mapa, têm ainda uma cache direta de 256
+ * entradas, pelo que o carregamento não calcula dispersões.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "frequencias.h"
+
+/** Nomes de cada frequência, indexados pelo identificador. */
+static char (*nomes)[TAMANHO_NOME_FREQUENCIA] = NULL;
+
+/** Frequências registadas e capacidade do vetor de nomes. */
+static int total = 0, capacidadeNomes = 0;
+
+/** Tabela de dispersão: identificador + 1 de cada entrada (0 se livre). */
+static int *tabela = NULL;
+
+/** Tamanho da tabela de dispersão (potência de 2). */
+static int capacidadeTabela = 0;
+
+/** Identificador + 1 da frequência com cada nome de um carácter (0 se ainda não existe). */
+static int porCaracter[256];
+
+/**
+ * @brief Dispersão FNV-1a de um nome.
+ *
+ * @param nome Nome da frequência.
+ * @return Valor de dispersão.
+ */
+
+static uint32_t dispersaoNome(const char *nome) {
+
+    uint32_t h = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *)nome; *c; c++) {
+        h = (h ^ *c) * 16777619u;
+    }
+
+    return h;
+
+}
+
+/**
+ * @brief Posição da tabela com o nome dado, ou a posição livre onde ficaria.
+ *
+ * @param nome Nome da frequência.
+ * @return Posição na tabela.
+ */
+
+static int posicaoTabela(const char *nome) {
+
+    int p = (int)(dispersaoNome(nome) & (uint32_t)(capacidadeTabela - 1));
+
+    while (tabela[p] && strcmp(nomes[tabela[p] - 1], nome) != 0) {
+        p = (p + 1) & (capacidadeTabela - 1);
+    }
+
+    return p;
+
+}
+
+/**
+ * @brief Duplica a tabela de dispersão e volta a inserir todos os nomes.
+ *
+ * @return true se a tabela cresceu, false em caso de falha de memória.
+ */
+
+static bool crescerTabela(void) {
+
+    int capacidade = capacidadeTabela ? 2 * capacidadeTabela : 64;
+    int *nova = (int *)calloc(capacidade, sizeof(int));
+    if (!nova) {
+        return false;
+    }
+
+    free(tabela);
+    tabela = nova;
+    capacidadeTabela = capacidade;
+
+    for (int i = 0; i < total; i++) {
+        tabela[posicaoTabela(nomes[i])] = i + 1;
+    }
+
+    return true;
+
+}
+
+/**
+ * @brief Obtém o identificador de um nome, registando-o se for novo.
+ *
+ * Nomes mais longos do que TAMANHO_NOME_FREQUENCIA - 1 são truncados.
+ *
+ * @param nome Nome da frequência (não vazio).
+ * @return Identificador, ou FREQUENCIA_QUALQUER se o nome for vazio, o dicionário
+ *         estiver cheio ou faltar memória.
+ */
+
+Frequencia codificarFrequencia(const char *nome) {
+
+    if (!nome || !*nome) {
+        return FREQUENCIA_QUALQUER;
+    }
+
+    char chave[TAMANHO_NOME_FREQUENCIA];
+    strncpy(chave, nome, sizeof(chave) - 1);
+    chave[sizeof(chave) - 1] = '\0';
+
+    if (2 * (total + 1) > capacidadeTabela && !crescerTabela()) {
+        return FREQUENCIA_QUALQUER;
+    }
+
+    int p = posicaoTabela(chave);
+    if (tabela[p]) {
+        return (Frequencia)(tabela[p] - 1);
+    }
+
+    if (total >= MAX_FREQUENCIAS) {
+        return FREQUENCIA_QUALQUER;
+    }
+
+    if (total == capacidadeNomes) {
+        int capacidade = capacidadeNomes ? 2 * capacidadeNomes : 64;
+        char (*novos)[TAMANHO_NOME_FREQUENCIA] = realloc(nomes, (size_t)capacidade * sizeof(*nomes));
+        if (!novos) {
+            return FREQUENCIA_QUALQUER;
+        }
+        nomes = novos;
+        capacidadeNomes = capacidade;
+    }
+
+    memcpy(nomes[total], chave, sizeof(chave));
+    tabela[p] = ++total;
+
+    return (Frequencia)(total - 1);
+
+}
+
+/**
+ * @brief Obtém o identificador da frequência com um nome de um só carácter.
+ *
+ * @param c Carácter (por exemplo, lido do mapa).
+ * @return Identificador, ou FREQUENCIA_QUALQUER em caso de falha.
+ */
+
+Frequencia frequenciaCaracter(char c) {
+
+    unsigned char u = (unsigned char)c;
+    if (porCaracter[u]) {
+        return (Frequencia)(porCaracter[u] - 1);
+    }
+
+    char nome[2] = { c, '\0' };
+    Frequencia f = codificarFrequencia(nome);
+    if (f != FREQUENCIA_QUALQUER) porCaracter[u] = f + 1;
+
+    return f;
+
+}
+
+/**
+ * @brief Procura um nome sem o registar.
+ *
+ * @param nome Nome da frequência.
+ * @param f Identificador encontrado.
+ * @return true se o nome já está registado.
+ */
+
+bool procurarFrequencia(const char *nome, Frequencia *f) {
+
+    if (!nome || !capacidadeTabela) {
+        return false;
+    }
+
+    char chave[TAMANHO_NOME_FREQUENCIA];
+    strncpy(chave, nome, sizeof(chave) - 1);
+    chave[sizeof(chave) - 1] = '\0';
+
+    int p = posicaoTabela(chave);
+    if (!tabela[p]) {
+        return false;
+    }
+
+    if (f) *f = (Frequencia)(tabela[p] - 1);
+
+    return true;
+
+}
+
+/**
+ * @brief Obtém o nome de uma frequência.
+ *
+ * @param f Identificador.
+ * @return Nome registado, "*" para FREQUENCIA_QUALQUER ou "?" se o identificador não existir.
+ */
+
+const char *nomeFrequencia(Frequencia f) {
+
+    if (f == FREQUENCIA_QUALQUER) {
+        return "*";
+    }
+
+    return f < total ? nomes[f] : "?";
+
+}
+
+/**
+ * @brief Número de frequências registadas (os identificadores válidos são 0 a n - 1).
+ *
+ * @return Número de frequências.
+ */
+
+int numFrequencias(void) {
+
+    return total;
+
+}
+
+/**
+ * @brief Esvazia o dicionário; os identificadores anteriores deixam de ser válidos.
+ */
+
+void libertarFrequencias(void) {
+
+    free(nomes);
+    free(tabela);
+    nomes = NULL;
+    tabela = NULL;
+    total = capacidadeNomes = capacidadeTabela = 0;
+    memset(porCaracter, 0, sizeof(porCaracter));
+
+}
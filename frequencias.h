@@ -0,0 +1,50 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file frequencias.h
+ * @author Thiago Abreu
+ * @brief Dicionário de frequências: cada nome de canal recebe um identificador denso.
+ *
+ * As antenas e os vértices guardam a frequência como um inteiro de 16 bits em vez
+ * de um carácter, pelo que deixa de haver o limite de 256 canais e o nome deixa de
+ * ter de ser um símbolo do mapa. Os identificadores são atribuídos por ordem de
+ * aparecimento, a partir de 0, o que permite agrupar por frequência com vetores
+ * indexados pelo identificador (de tamanho `numFrequencias()`).
+ *
+ * O dicionário é único para o processo. A codificação de nomes novos não é segura
+ * entre threads; a leitura (`nomeFrequencia`) é, desde que não decorra em paralelo
+ * com codificações.
+ */
+
+#ifndef FREQUENCIAS_H
+#define FREQUENCIAS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Identificador denso de uma frequência. */
+typedef uint16_t Frequencia;
+
+/** Valor reservado: em filtros significa "qualquer frequência"; como resultado, falha. */
+#define FREQUENCIA_QUALQUER ((Frequencia)UINT16_MAX)
+
+/** Número máximo de frequências distintas. */
+#define MAX_FREQUENCIAS ((int)UINT16_MAX)
+
+/** Tamanho máximo do nome de uma frequência (incluindo o terminador). */
+#define TAMANHO_NOME_FREQUENCIA 32
+
+Frequencia codificarFrequencia(const char *nome);
+Frequencia frequenciaCaracter(char c);
+bool procurarFrequencia(const char *nome, Frequencia *f);
+const char *nomeFrequencia(Frequencia f);
+int numFrequencias(void);
+void libertarFrequencias(void);
+
+#endif
@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include "funcoes.h"
 #include "antenas.h"
+#include "instrumentacao.h"
 
 /**
  * @brief Carrega antenas a partir de um ficheiro de texto.
@@ -44,6 +45,8 @@ Antena *carregarAntenas(const char *nomeFicheiro, int *linhas, int *colunas) {
         return false;
     }
 
+    INSTR_INICIO(inicioCarga);
+
     Antena *lista = NULL;
     char c;
     int x=0, y=0;
@@ -62,7 +65,7 @@ Antena *carregarAntenas(const char *nomeFicheiro, int *linhas, int *colunas) {
             y = 0;
         } else {
             if (c != '.') {
-                lista = inserirAntena(lista,c,x,y);
+                lista = inserirAntena(lista,frequenciaCaracter(c),x,y);
                 if (!lista) {
                     fclose(ficheiro);
                     // Erro ao inserir
@@ -76,6 +79,7 @@ Antena *carregarAntenas(const char *nomeFicheiro, int *linhas, int *colunas) {
 
     *linhas = x + 1;
     fclose(ficheiro);
+    INSTR_FIM(CRONOMETRO_CARREGAR_ANTENAS, inicioCarga);
     return lista;
 
 }
@@ -143,6 +147,7 @@ bool existePosicao(Coordenada *lista, int x, int y) {
 
     while (lista) {
 
+        INSTR_CONTAR(CONTADOR_NOS_EXISTE_POSICAO, 1);
         if (lista -> x == x && lista -> y == y) return true;
         lista = lista -> proximo;
 
@@ -171,6 +176,7 @@ Coordenada *adicionarPosicao(Coordenada *lista, int x, int y) {
 
     Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
     if (!nova) return false;
+    INSTR_CONTAR(CONTADOR_ALOC_COORDENADA, 1);
 
     nova -> x = x;
     nova -> y = y;
@@ -0,0 +1,308 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file gerador.c
+ * @author Thiago Abreu
+ * @brief Implementação dos geradores de grafos sintéticos.
+ *
+ * Os vértices são construídos já pela ordem (x, y) e ligados diretamente,
+ * sem passar pelas procuras lineares de `inserirVertice` e `conectarVertices`,
+ * para que a geração não domine o tempo dos benchmarks.
+ *
+ * Os mapas de antenas são sorteados célula a célula, por linhas. A frequência
+ * dominante de cada bloco é derivada da semente e das coordenadas do bloco, pelo
+ * que o mapa escrito em ficheiro e a lista gerada em memória são idênticos.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "gerador.h"
+#include "funcoes.h"
+
+/** Caracteres usados como frequências nos mapas gerados. */
+static const char FREQUENCIAS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+
+/**
+ * @brief Gerador pseudoaleatório xorshift64*.
+ *
+ * @param estado Estado do gerador (diferente de zero; atualizado).
+ * @return Próximo valor pseudoaleatório de 64 bits.
+ */
+
+uint64_t proximoAleatorio(uint64_t *estado) {
+
+    uint64_t x = *estado;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *estado = x;
+
+    return x * 0x2545F4914F6CDD1DULL;
+
+}
+
+/**
+ * @brief Gera um grafo com frequências densas (muitas ligações por vértice).
+ *
+ * Os vértices ocupam metade das células de uma grelha quadrada, escolhidas por
+ * amostragem sequencial, o que os produz já ordenados. Cada vértice recebe uma
+ * frequência ao acaso e cerca de `grauMedio` ligações para vértices da mesma frequência.
+ *
+ * @param numVertices Número de vértices a gerar.
+ * @param numFrequencias Número de frequências distintas (entre 1 e 62).
+ * @param grauMedio Grau médio pretendido.
+ * @param semente Semente do gerador pseudoaleatório.
+ * @return Apontador para o início da lista de vértices, ou false em caso de erro.
+ */
+
+Vertice *gerarGrafoDenso(int numVertices, int numFrequencias, int grauMedio, unsigned int semente) {
+
+    int maxFrequencias = (int)sizeof(FREQUENCIAS) - 1;
+    if (numVertices <= 0) return false;
+    if (numFrequencias < 1) numFrequencias = 1;
+    if (numFrequencias > maxFrequencias) numFrequencias = maxFrequencias;
+
+    uint64_t estado = 0x9E3779B97F4A7C15ULL ^ semente;
+    if (!estado) estado = 1;
+
+    Frequencia ids[sizeof(FREQUENCIAS)];
+    for (int f = 0; f < numFrequencias; f++) {
+        ids[f] = frequenciaCaracter(FREQUENCIAS[f]);
+        if (ids[f] == FREQUENCIA_QUALQUER) return false;
+    }
+
+    long long lado = 1;
+    while (lado * lado < 2LL * numVertices) lado++;
+    long long celulas = lado * lado;
+
+    Vertice **vertices = (Vertice **)malloc(numVertices * sizeof(Vertice *));
+    int *porFrequencia = (int *)malloc(numVertices * sizeof(int));
+    int *inicioFrequencia = (int *)calloc(numFrequencias + 1, sizeof(int));
+
+    if (!vertices || !porFrequencia || !inicioFrequencia) {
+        free(vertices);
+        free(porFrequencia);
+        free(inicioFrequencia);
+        return false;
+    }
+
+    // Amostragem sequencial: escolhe numVertices células distintas por ordem crescente
+    Vertice *grafo = NULL, *ultimo = NULL;
+    int escolhidos = 0;
+    for (long long c = 0; c < celulas && escolhidos < numVertices; c++) {
+
+        long long restantes = celulas - c;
+        if ((long long)(proximoAleatorio(&estado) % restantes) >= numVertices - escolhidos) continue;
+
+        int f = (int)(proximoAleatorio(&estado) % numFrequencias);
+        Vertice *v = criarVertice(ids[f], (int)(c / lado), (int)(c % lado));
+        if (!v) {
+            free(vertices);
+            free(porFrequencia);
+            free(inicioFrequencia);
+            return libertarGrafo(grafo);
+        }
+
+        if (ultimo) ultimo -> proximo = v;
+        else grafo = v;
+        v -> anterior = ultimo;
+        ultimo = v;
+
+        vertices[escolhidos++] = v;
+        inicioFrequencia[f + 1]++;
+
+    }
+
+    // Agrupa os vértices por frequência para escolher destinos compatíveis
+    for (int f = 0; f < numFrequencias; f++) {
+        inicioFrequencia[f + 1] += inicioFrequencia[f];
+    }
+
+    int *preenchidos = (int *)calloc(numFrequencias, sizeof(int));
+    if (!preenchidos) {
+        free(vertices);
+        free(porFrequencia);
+        free(inicioFrequencia);
+        return libertarGrafo(grafo);
+    }
+
+    for (int i = 0; i < escolhidos; i++) {
+        int f = 0;
+        while (ids[f] != vertices[i] -> frequencia) f++;
+        porFrequencia[inicioFrequencia[f] + preenchidos[f]++] = i;
+    }
+
+    // Cada ligação cria duas arestas, por isso cada vértice inicia grauMedio / 2 ligações
+    for (int i = 0; i < escolhidos; i++) {
+
+        int f = 0;
+        while (ids[f] != vertices[i] -> frequencia) f++;
+
+        int tamanho = inicioFrequencia[f + 1] - inicioFrequencia[f];
+        if (tamanho < 2) continue;
+
+        for (int k = 0; k < grauMedio / 2; k++) {
+
+            int j = porFrequencia[inicioFrequencia[f] + (int)(proximoAleatorio(&estado) % tamanho)];
+            if (j == i) continue;
+            ligarVertices(vertices[i], vertices[j]);
+
+        }
+
+    }
+
+    free(vertices);
+    free(porFrequencia);
+    free(inicioFrequencia);
+    free(preenchidos);
+
+    return grafo;
+
+}
+
+/**
+ * @brief Normaliza os parâmetros de um mapa para valores válidos.
+ *
+ * @param p Parâmetros a corrigir.
+ */
+
+static void normalizarParametros(ParametrosMapa *p) {
+
+    int maxFrequencias = (int)sizeof(FREQUENCIAS) - 1;
+
+    if (p -> linhas < 0) p -> linhas = 0;
+    if (p -> colunas < 0) p -> colunas = 0;
+    if (p -> densidade < 0.0) p -> densidade = 0.0;
+    if (p -> densidade > 1.0) p -> densidade = 1.0;
+    if (p -> numFrequencias < 1) p -> numFrequencias = 1;
+    if (p -> numFrequencias > maxFrequencias) p -> numFrequencias = maxFrequencias;
+    if (p -> agrupamento < 0.0) p -> agrupamento = 0.0;
+    if (p -> agrupamento > 1.0) p -> agrupamento = 1.0;
+
+}
+
+/**
+ * @brief Sorteia o conteúdo de uma célula do mapa.
+ *
+ * @param p Parâmetros do mapa.
+ * @param estado Estado do gerador (atualizado).
+ * @param x Linha da célula.
+ * @param y Coluna da célula.
+ * @return Frequência da antena, ou '.' se a célula ficar vazia.
+ */
+
+static char sortearCelula(const ParametrosMapa *p, uint64_t *estado, int x, int y) {
+
+    const double escala = 1.0 / 18446744073709551616.0;
+
+    if (proximoAleatorio(estado) * escala >= p -> densidade) {
+        return '.';
+    }
+
+    if (proximoAleatorio(estado) * escala < p -> agrupamento) {
+        uint64_t bloco = ((uint64_t)(x / LADO_BLOCO_AGRUPAMENTO) << 32) ^ (uint64_t)(y / LADO_BLOCO_AGRUPAMENTO);
+        uint64_t h = (bloco ^ p -> semente) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+        return FREQUENCIAS[(h * 0xBF58476D1CE4E5B9ULL >> 32) % p -> numFrequencias];
+    }
+
+    return FREQUENCIAS[proximoAleatorio(estado) % p -> numFrequencias];
+
+}
+
+/**
+ * @brief Gera em memória a lista de antenas de um mapa sintético.
+ *
+ * As células são percorridas por linhas, o que produz a lista já ordenada por (x, y)
+ * sem as procuras lineares de `inserirAntena`.
+ *
+ * @param p Parâmetros do mapa.
+ * @return Lista de antenas (NULL se o mapa ficar vazio), ou false em caso de falha de memória.
+ */
+
+Antena *gerarAntenas(ParametrosMapa p) {
+
+    normalizarParametros(&p);
+
+    uint64_t estado = 0x9E3779B97F4A7C15ULL ^ p.semente;
+    if (!estado) estado = 1;
+
+    Antena *lista = NULL, *ultima = NULL;
+
+    for (int x = 0; x < p.linhas; x++) {
+        for (int y = 0; y < p.colunas; y++) {
+
+            char c = sortearCelula(&p, &estado, x, y);
+            if (c == '.') continue;
+
+            Antena *nova = (Antena *)malloc(sizeof(Antena));
+            if (!nova) {
+                return libertarAntenas(lista);
+            }
+
+            nova -> frequencia = frequenciaCaracter(c);
+            nova -> x = x;
+            nova -> y = y;
+            nova -> proximo = NULL;
+
+            if (ultima) ultima -> proximo = nova;
+            else lista = nova;
+            ultima = nova;
+
+        }
+    }
+
+    return lista;
+
+}
+
+/**
+ * @brief Escreve um mapa sintético num ficheiro, no formato de `carregarAntenas`.
+ *
+ * @param nomeFicheiro Ficheiro a criar.
+ * @param p Parâmetros do mapa.
+ * @return true se o ficheiro foi escrito.
+ */
+
+bool gerarMapa(const char *nomeFicheiro, ParametrosMapa p) {
+
+    normalizarParametros(&p);
+
+    FILE *ficheiro = fopen(nomeFicheiro, "w");
+    char *linha = (char *)malloc((size_t)p.colunas + 1);
+
+    if (!ficheiro || !linha) {
+        if (ficheiro) fclose(ficheiro);
+        free(linha);
+        return false;
+    }
+
+    uint64_t estado = 0x9E3779B97F4A7C15ULL ^ p.semente;
+    if (!estado) estado = 1;
+
+    bool sucesso = true;
+    for (int x = 0; x < p.linhas && sucesso; x++) {
+
+        for (int y = 0; y < p.colunas; y++) {
+            linha[y] = sortearCelula(&p, &estado, x, y);
+        }
+
+        // A última linha não termina em '\n', para `carregarAntenas` contar exatamente p.linhas
+        size_t tamanho = (size_t)p.colunas;
+        if (x + 1 < p.linhas) linha[tamanho++] = '\n';
+        sucesso = fwrite(linha, 1, tamanho, ficheiro) == tamanho;
+
+    }
+
+    free(linha);
+    if (fclose(ficheiro) != 0) sucesso = false;
+
+    return sucesso;
+
+}
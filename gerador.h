@@ -0,0 +1,47 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file gerador.h
+ * @author Thiago Abreu
+ * @brief Geração determinística de grafos sintéticos para benchmarks.
+ *
+ * A mesma semente produz sempre o mesmo grafo, o que permite comparar
+ * tempos entre versões do código.
+ */
+
+#ifndef GERADOR_H
+#define GERADOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "antenas.h"
+#include "grafo.h"
+
+/** Lado dos blocos da grelha que partilham uma frequência dominante. */
+#define LADO_BLOCO_AGRUPAMENTO 8
+
+/**
+ * @struct ParametrosMapa
+ * @brief Parâmetros de um mapa de antenas sintético.
+ */
+
+typedef struct ParametrosMapa {
+    int linhas, colunas;     /**< Dimensões do mapa */
+    double densidade;        /**< Fração de células com antena (0 a 1) */
+    int numFrequencias;      /**< Número de frequências distintas (entre 1 e 62) */
+    double agrupamento;      /**< Probabilidade de uma antena usar a frequência dominante do seu bloco */
+    unsigned int semente;    /**< Semente do gerador pseudoaleatório */
+} ParametrosMapa;
+
+uint64_t proximoAleatorio(uint64_t *estado);
+Vertice *gerarGrafoDenso(int numVertices, int numFrequencias, int grauMedio, unsigned int semente);
+Antena *gerarAntenas(ParametrosMapa p);
+bool gerarMapa(const char *nomeFicheiro, ParametrosMapa p);
+
+#endif
@@ -19,6 +19,7 @@
 #include <stdbool.h>
 #include "grafo.h"
 #include "funcoes.h"
+#include "instrumentacao.h"
 
 /**
  * @brief Carrega uma matriz de antenas de um ficheiro de texto para um grafo dinâmico.
@@ -63,7 +64,7 @@ Vertice *carregarGrafo(const char *nomeFicheiro, int *linhas, int *colunas) {
             y = 0;
         } else {
             if (c != '.') {
-                grafo = inserirVertice(grafo, c, x, y);
+                grafo = inserirVertice(grafo, frequenciaCaracter(c), x, y);
             }
             y++;
         }
@@ -84,13 +85,13 @@ Vertice *carregarGrafo(const char *nomeFicheiro, int *linhas, int *colunas) {
  * Se já existir um vértice nas mesmas coordenadas (x, y), a inserção é ignorada.
  *
  * @param grafo Apontador para o início da lista de vértices.
- * @param frequencia Caractere que representa a frequência da antena.
+ * @param frequencia Identificador da frequência da antena.
  * @param x Coordenada X do novo vértice.
  * @param y Coordenada Y do novo vértice.
  * @return Apontador para o início atualizado da lista, ou false em caso de erro ou duplicada.
  */
 
-Vertice *inserirVertice(Vertice *grafo, char frequencia, int x, int y) {
+Vertice *inserirVertice(Vertice *grafo, Frequencia frequencia, int x, int y) {
 
     // Verificar duplicados
 
@@ -114,9 +115,29 @@ Vertice *inserirVertice(Vertice *grafo, char frequencia, int x, int y) {
 
     }
 
+    return encadearVertice(grafo, novo);
+}
+
+/**
+ * @brief Encadeia um vértice já criado na sua posição ordenada da lista.
+ *
+ * Não verifica duplicados; é o passo comum a `inserirVertice` e às inserções
+ * que já verificaram a posição por outro meio (por exemplo, um índice de coordenadas).
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param novo Vértice a encadear (sem ligações na lista).
+ * @return Apontador para o início atualizado da lista.
+ */
+
+Vertice *encadearVertice(Vertice *grafo, Vertice *novo) {
+
+    int x = novo -> x, y = novo -> y;
+
     if (!grafo || x < grafo -> x || (x == grafo -> x && y < grafo -> y)) {
 
         novo -> proximo = grafo;
+        novo -> anterior = NULL;
+        if (grafo) grafo -> anterior = novo;
         return novo;
 
     }
@@ -137,9 +158,71 @@ Vertice *inserirVertice(Vertice *grafo, char frequencia, int x, int y) {
     }
 
     novo -> proximo = atual -> proximo;
+    novo -> anterior = atual;
+    if (atual -> proximo) atual -> proximo -> anterior = novo;
     atual -> proximo = novo;
 
     return grafo;
+
+}
+
+/**
+ * @brief Retira uma aresta da lista de adjacência do seu vértice de origem.
+ *
+ * @param dono Vértice em cuja lista a aresta está.
+ * @param a Aresta a retirar (não é libertada).
+ */
+
+static void desligarAresta(Vertice *dono, Aresta *a) {
+
+    if (a -> anterior) a -> anterior -> proximo = a -> proximo;
+    else dono -> arestas = a -> proximo;
+
+    if (a -> proximo) a -> proximo -> anterior = a -> anterior;
+
+}
+
+/**
+ * @brief Remove um vértice do grafo e todas as ligações em que participa.
+ *
+ * Cada aresta do vértice conhece a sua inversa na lista do vizinho, e as listas
+ * são duplamente ligadas, pelo que o custo é O(grau do vértice), sem percorrer
+ * os restantes vértices.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param v Vértice a remover (tem de pertencer ao grafo).
+ * @return Apontador para o início atualizado da lista.
+ */
+
+Vertice *removerVertice(Vertice *grafo, Vertice *v) {
+
+    if (!v) {
+        return grafo;
+    }
+
+    while (v -> arestas) {
+
+        Aresta *a = v -> arestas;
+        Aresta *inversa = a -> inversa;
+
+        desligarAresta(v, a);
+        if (inversa) {
+            desligarAresta(a -> destino, inversa);
+            free(inversa);
+        }
+        free(a);
+
+    }
+
+    if (v -> anterior) v -> anterior -> proximo = v -> proximo;
+    else grafo = v -> proximo;
+
+    if (v -> proximo) v -> proximo -> anterior = v -> anterior;
+
+    free(v);
+
+    return grafo;
+
 }
 
 /**
@@ -151,13 +234,18 @@ Vertice *inserirVertice(Vertice *grafo, char frequencia, int x, int y) {
  * Esta função não insere o vértice diretamente no grafo — ela apenas o cria. 
  * A inserção ordenada é feita posteriormente pela função `inserirVertice`.
  *
- * @param frequencia Letra que identifica a frequência de ressonância da antena.
+ * @param frequencia Identificador da frequência de ressonância da antena.
  * @param x Coordenada X da antena.
  * @param y Coordenada Y da antena.
- * @return Apontador para o novo vértice criado ou false se a alocação falhar.
+ * @return Apontador para o novo vértice criado ou false se a alocação falhar
+ *         ou a frequência for FREQUENCIA_QUALQUER.
  */
 
-Vertice *criarVertice(char frequencia, int x, int y) {
+Vertice *criarVertice(Frequencia frequencia, int x, int y) {
+
+    if (frequencia == FREQUENCIA_QUALQUER) {
+        return false;
+    }
 
     Vertice *novo = (Vertice *)malloc(sizeof(Vertice));
 
@@ -167,11 +255,14 @@ Vertice *criarVertice(char frequencia, int x, int y) {
 
     }
 
+    INSTR_CONTAR(CONTADOR_ALOC_VERTICE, 1);
+
     novo -> frequencia = frequencia;
     novo -> x = x;
     novo -> y = y;
     novo -> arestas = NULL;
     novo -> proximo = NULL;
+    novo -> anterior = NULL;
 
     return novo;
 
@@ -210,19 +301,45 @@ bool conectarVertices(Vertice *grafo, int x1, int y1, int x2, int y2) {
         return false;
     }
 
+    return ligarVertices(v1, v2);
+
+}
+
+/**
+ * @brief Cria as duas arestas (ida e volta) entre dois vértices já localizados.
+ *
+ * Não verifica frequências nem duplicados; é o passo comum a `conectarVertices`
+ * e aos construtores de grafos que já conhecem os apontadores dos vértices.
+ *
+ * @param v1 Primeiro vértice.
+ * @param v2 Segundo vértice.
+ * @return true se as arestas foram criadas, false em caso de falha de memória.
+ */
+
+bool ligarVertices(Vertice *v1, Vertice *v2) {
+
     Aresta *a1 = (Aresta *)malloc(sizeof(Aresta));
     Aresta *a2 = (Aresta *)malloc(sizeof(Aresta));
 
     if (!a1 || !a2) {
+        free(a1);
+        free(a2);
         return false;
     }
+    INSTR_CONTAR(CONTADOR_ALOC_ARESTA, 2);
 
     a1 -> destino = v2;
+    a1 -> inversa = a2;
+    a1 -> anterior = NULL;
     a1 -> proximo = v1 -> arestas;
+    if (v1 -> arestas) v1 -> arestas -> anterior = a1;
     v1 -> arestas = a1;
 
     a2 -> destino = v1;
+    a2 -> inversa = a1;
+    a2 -> anterior = NULL;
     a2 -> proximo = v2 -> arestas;
+    if (v2 -> arestas) v2 -> arestas -> anterior = a2;
     v2 -> arestas = a2;
 
     return true;
@@ -287,15 +404,20 @@ Coordenada *buscaProfundidadeRecursiva(Vertice *v, Coordenada *visitados, Coorde
 
     visitados = adicionarPosicao(visitados, v->x, v->y);
     resultado = adicionarPosicao(resultado, v->x, v->y);
+    INSTR_CONTAR(CONTADOR_PROFUNDIDADE_VERTICES, 1);
 
     Aresta *a = v->arestas;
     while (a) {
 
+        INSTR_CONTAR(CONTADOR_PROFUNDIDADE_ARESTAS, 1);
         resultado = buscaProfundidadeRecursiva(a->destino, visitados, resultado);
         a = a -> proximo;
 
     }
 
+    // Liberta só o nó acrescentado nesta chamada; o resto da lista pertence ao chamador
+    free(visitados);
+
     return resultado;
 
 }
@@ -333,10 +455,12 @@ Coordenada *procuraProfundidade(Vertice *grafo, int x, int y) {
         return false;
     }
 
+    INSTR_INICIO(inicioProcura);
     Coordenada *visitados = NULL;
     Coordenada *resultado = NULL;
     resultado = buscaProfundidadeRecursiva(inicio, visitados, resultado);
     libertarCoordenadas(visitados);
+    INSTR_FIM(CRONOMETRO_PROCURA_PROFUNDIDADE, inicioProcura);
 
     return resultado;
 }
@@ -361,6 +485,7 @@ FilaVertice *enfileirar(FilaVertice *fim, Vertice *v) {
     if (!novo) {
         return false;
     }
+    INSTR_CONTAR(CONTADOR_ALOC_FILA, 1);
 
     novo -> v = v;
     novo -> proximo = NULL;
@@ -491,6 +616,7 @@ Coordenada *procuraLargura(Vertice *grafo, int x, int y) {
 
     }
 
+    INSTR_INICIO(inicioProcura);
     Coordenada *visitados = NULL;
     Coordenada *resultado = NULL;
 
@@ -509,10 +635,13 @@ Coordenada *procuraLargura(Vertice *grafo, int x, int y) {
 
         Vertice *vAtual = primeiroFila(filaInicio);
         filaInicio = desenfileirar(filaInicio);
+        if (!filaInicio) filaFim = NULL; // O último nó foi libertado
+        INSTR_CONTAR(CONTADOR_LARGURA_VERTICES, 1);
 
         for (Aresta *a = vAtual->arestas; a; a = a->proximo) {
 
             Vertice *vizinho = a->destino;
+            INSTR_CONTAR(CONTADOR_LARGURA_ARESTAS, 1);
 
             if (!existePosicao(visitados, vizinho->x, vizinho->y)) {
                 
@@ -529,6 +658,7 @@ Coordenada *procuraLargura(Vertice *grafo, int x, int y) {
 
     libertarFila(filaInicio);
     libertarCoordenadas(visitados);
+    INSTR_FIM(CRONOMETRO_PROCURA_LARGURA, inicioProcura);
     return resultado;
 
 }
@@ -615,6 +745,9 @@ Coordenada *buscarCaminhos(Vertice *atual, int xDestino, int yDestino, Coordenad
         return resultado;
     }
 
+    INSTR_CONTAR(CONTADOR_CAMINHOS_CHAMADAS, 1);
+    INSTR_ENTRAR(CONTADOR_CAMINHOS_PROFUNDIDADE_MAX);
+
     Coordenada *novoVisitado = adicionarPosicao(visitados, atual -> x, atual ->y);
     Coordenada *novoCaminho = adicionarPosicao(caminho, atual->x, atual->y);
 
@@ -624,9 +757,10 @@ Coordenada *buscarCaminhos(Vertice *atual, int xDestino, int yDestino, Coordenad
         resultado = acumularCaminho(resultado, copiado);
 
         libertarCoordenadas(copiado);
-        libertarCoordenadas(novoVisitado);
-        libertarCoordenadas(novoCaminho);
+        free(novoVisitado);
+        free(novoCaminho);
 
+        INSTR_SAIR();
         return resultado;
 
     }
@@ -640,9 +774,11 @@ Coordenada *buscarCaminhos(Vertice *atual, int xDestino, int yDestino, Coordenad
 
     }
 
-    libertarCoordenadas(novoVisitado);
-    libertarCoordenadas(novoCaminho);
+    // Liberta só os nós acrescentados nesta chamada; os restantes pertencem ao chamador
+    free(novoVisitado);
+    free(novoCaminho);
 
+    INSTR_SAIR();
     return resultado;
 }
 
@@ -658,30 +794,62 @@ Coordenada *buscarCaminhos(Vertice *atual, int xDestino, int yDestino, Coordenad
  * @param grafo Apontador para o início da lista de vértices do grafo.
  * @param freqA Frequência do primeiro grupo de antenas.
  * @param freqB Frequência do segundo grupo de antenas.
- * @return Lista de coordenadas dos pares de intersecções encontradas.
+ * @return Lista de coordenadas dos pares de intersecções encontradas, ou NULL se não houver
+ *         nenhum par ou faltar memória.
  */
 
-Coordenada *intersecoesFrequencias(Vertice *grafo, char freqA,char freqB) {
+Coordenada *intersecoesFrequencias(Vertice *grafo, Frequencia freqA, Frequencia freqB) {
 
     Coordenada *resultado = NULL;
 
-    for (Vertice *a = grafo; a !=NULL; a = a->proximo) {
+    // Separa as antenas das duas frequências em vetores, em vez de percorrer a lista por cada antena de freqA
+    int total[2] = { 0, 0 };
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        total[0] += v -> frequencia == freqA;
+        total[1] += v -> frequencia == freqB;
+    }
 
-        if (a->frequencia != freqA) {
-            continue;
-        }
+    if (!total[0] || !total[1]) {
+        return resultado;
+    }
 
-        for (Vertice *b = grafo; b != NULL; b = b->proximo) {
+    Vertice **grupos[2];
+    grupos[0] = (Vertice **)malloc(total[0] * sizeof(Vertice *));
+    grupos[1] = (Vertice **)malloc(total[1] * sizeof(Vertice *));
+    if (!grupos[0] || !grupos[1]) {
+        free(grupos[0]);
+        free(grupos[1]);
+        return resultado;
+    }
+
+    int usados[2] = { 0, 0 };
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        if (v -> frequencia == freqA) grupos[0][usados[0]++] = v;
+        if (v -> frequencia == freqB) grupos[1][usados[1]++] = v;
+    }
 
-            if (b->frequencia != freqB) {
-                continue;
+    bool semMemoria = false;
+    for (int i = 0; i < total[0] && !semMemoria; i++) {
+
+        for (int j = 0; j < total[1] && !semMemoria; j++) {
+            Vertice *par[2] = { grupos[0][i], grupos[1][j] };
+            for (int k = 0; k < 2; k++) {
+                Coordenada *nova = adicionarPosicao(resultado, par[k] -> x, par[k] -> y);
+                if (!nova) {
+                    semMemoria = true;
+                    break;
+                }
+                resultado = nova;
             }
+        }
 
-            resultado = adicionarPosicao(resultado, a->x, a->y);
-            resultado = adicionarPosicao(resultado, b->x, b->y);
+    }
 
-        }
+    free(grupos[0]);
+    free(grupos[1]);
 
+    if (semMemoria) {
+        return libertarCoordenadas(resultado);
     }
 
     return resultado;
@@ -716,11 +884,13 @@ Coordenada *caminhosEntreAntenas(Vertice *grafo, int x1, int y1, int x2, int y2)
 
     if (!inicio) return NULL;
 
+    INSTR_INICIO(inicioCaminhos);
     Coordenada *visitados = NULL;
     Coordenada *caminho = NULL;
     Coordenada *resultado = NULL;
 
     resultado = buscarCaminhos(inicio, x2, y2, visitados, caminho, resultado);
     libertarCoordenadas(visitados);
+    INSTR_FIM(CRONOMETRO_CAMINHOS, inicioCaminhos);
     return resultado;
 }
@@ -33,6 +33,8 @@ struct Vertice;
  typedef struct Aresta {
     struct Vertice *destino; /**< Destino da aresta */
     struct Aresta *proximo;  /**< Próxima aresta na lista */
+    struct Aresta *anterior; /**< Aresta anterior na lista (NULL se for a primeira) */
+    struct Aresta *inversa;  /**< Aresta do sentido contrário, na lista do destino */
  } Aresta;
 
  /**
@@ -41,10 +43,11 @@ struct Vertice;
  */
 
  typedef struct Vertice {
-    char frequencia;          /**< Frequência da antena */
+    Frequencia frequencia;    /**< Frequência da antena */
     int x, y;                 /**< Coordenadas da antena */
     Aresta *arestas;          /**< Lista de arestas conectadas */
     struct Vertice *proximo;  /**< Próximo vértice na lista */
+    struct Vertice *anterior; /**< Vértice anterior na lista (NULL se for o primeiro) */
  } Vertice;
 
  /**
@@ -57,9 +60,12 @@ struct Vertice;
    struct FilaVertice *proximo;   /**< Próximo elemento na fila */
  } FilaVertice;
 
-Vertice *criarVertice (char frequencia, int x, int y);
-Vertice *inserirVertice(Vertice *grafo, char frequencia, int x, int y);
+Vertice *criarVertice (Frequencia frequencia, int x, int y);
+Vertice *inserirVertice(Vertice *grafo, Frequencia frequencia, int x, int y);
+Vertice *encadearVertice(Vertice *grafo, Vertice *novo);
+Vertice *removerVertice(Vertice *grafo, Vertice *v);
 bool conectarVertices(Vertice *grafo, int x1, int y1, int x2, int y2);
+bool ligarVertices(Vertice *v1, Vertice *v2);
 Vertice *libertarGrafo(Vertice *grafo);
 Vertice *carregarGrafo(const char *nomeFicheiro, int *linhas, int *colunas);
 FilaVertice *enfileirar(FilaVertice *fim, Vertice *v);
@@ -69,8 +75,8 @@ bool filaVazia(FilaVertice *inicio);
 FilaVertice *libertarFila(FilaVertice *inicio);
 Coordenada *procuraLargura(Vertice *grafo, int x, int y);
 Coordenada *acumularCaminho(Coordenada *acumulador, Coordenada *caminho);
-Coordenada *intersecoesFrequencias(Vertice *grafo, char freqA, char freqB);
+Coordenada *intersecoesFrequencias(Vertice *grafo, Frequencia freqA, Frequencia freqB);
 Coordenada *procuraProfundidade(Vertice *grafo, int x, int y);
 Coordenada *caminhosEntreAntenas(Vertice *grafo, int x1, int y1, int x2, int y2);
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,365 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file grafocsr.c
+ * @author Thiago Abreu
+ * @brief Conversão do grafo em listas ligadas para o formato compacto CSR.
+ *
+ * A conversão percorre a lista de vértices uma vez para atribuir índices e
+ * outra para copiar as arestas. Como a lista está ordenada por (x, y), o índice
+ * de um vértice é obtido por procura binária nas coordenadas.
+ *
+ * A reordenação segundo a curva de Hilbert ordena os vértices pela posição na
+ * curva e copia atributos e adjacências por essa ordem, traduzindo os destinos.
+ * A ordem (x, y) fica guardada numa permutação, para a procura binária continuar
+ * a funcionar.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "grafocsr.h"
+#include "hilbert.h"
+
+/**
+ * @struct ChaveVertice
+ * @brief Vértice e a sua posição na curva de Hilbert, para ordenação.
+ */
+
+typedef struct ChaveVertice {
+    uint64_t chave;    /**< Posição na curva */
+    int vertice;       /**< Índice do vértice no grafo original */
+} ChaveVertice;
+
+/**
+ * @brief Constrói a representação CSR a partir da lista de vértices do grafo.
+ *
+ * Os vértices recebem índices pela ordem em que aparecem na lista e as arestas
+ * de cada vértice são copiadas pela mesma ordem da sua lista de adjacência.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @return Grafo compacto construído, ou false em caso de falha de memória.
+ */
+
+GrafoCSR *construirGrafoCSR(Vertice *grafo) {
+
+    GrafoCSR *g = (GrafoCSR *)calloc(1, sizeof(GrafoCSR));
+    if (!g) {
+        return false;
+    }
+
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        g -> numVertices++;
+        for (Aresta *a = v -> arestas; a; a = a -> proximo) {
+            g -> numArcos++;
+        }
+    }
+
+    int n = g -> numVertices;
+    g -> frequencia = (Frequencia *)malloc((n > 0 ? n : 1) * sizeof(Frequencia));
+    g -> x = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    g -> y = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    g -> inicioArestas = (int *)malloc((n + 1) * sizeof(int));
+    g -> destinos = (int *)malloc((g -> numArcos > 0 ? g -> numArcos : 1) * sizeof(int));
+
+    if (!g -> frequencia || !g -> x || !g -> y || !g -> inicioArestas || !g -> destinos) {
+        return libertarGrafoCSR(g);
+    }
+
+    int i = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo, i++) {
+        g -> frequencia[i] = v -> frequencia;
+        g -> x[i] = v -> x;
+        g -> y[i] = v -> y;
+    }
+
+    int k = 0;
+    i = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo, i++) {
+
+        g -> inicioArestas[i] = k;
+
+        for (Aresta *a = v -> arestas; a; a = a -> proximo) {
+            g -> destinos[k++] = indiceVerticeCSR(g, a -> destino -> x, a -> destino -> y);
+        }
+
+    }
+    g -> inicioArestas[n] = k;
+
+    return g;
+
+}
+
+/**
+ * @brief Compara duas chaves de vértice, para `qsort`.
+ *
+ * @param a Primeira chave.
+ * @param b Segunda chave.
+ * @return Negativo, zero ou positivo; empates desfeitos pelo índice original.
+ */
+
+static int compararChavesVertice(const void *a, const void *b) {
+
+    const ChaveVertice *p = (const ChaveVertice *)a, *q = (const ChaveVertice *)b;
+
+    if (p -> chave != q -> chave) return p -> chave < q -> chave ? -1 : 1;
+
+    return (p -> vertice > q -> vertice) - (p -> vertice < q -> vertice);
+
+}
+
+/**
+ * @brief Cria uma cópia do grafo com os vértices numerados ao longo da curva de Hilbert.
+ *
+ * As coordenadas são deslocadas pelo canto inferior do conjunto, para a curva não
+ * depender do sinal. A adjacência de cada vértice mantém a ordem original (com os
+ * destinos renumerados), pelo que as travessias visitam os mesmos vértices pela
+ * mesma ordem; só mudam os índices. O grafo original não é alterado.
+ *
+ * @param g Grafo compacto.
+ * @return Grafo reordenado (a libertar com `libertarGrafoCSR`), ou false em caso de falha de memória.
+ */
+
+GrafoCSR *reordenarGrafoCSR(const GrafoCSR *g) {
+
+    if (!g) {
+        return false;
+    }
+
+    GrafoCSR *r = (GrafoCSR *)calloc(1, sizeof(GrafoCSR));
+    if (!r) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    r -> numVertices = n;
+    r -> numArcos = g -> numArcos;
+    r -> frequencia = (Frequencia *)malloc((n > 0 ? n : 1) * sizeof(Frequencia));
+    r -> x = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    r -> y = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    r -> inicioArestas = (int *)malloc((n + 1) * sizeof(int));
+    r -> destinos = (int *)malloc((g -> numArcos > 0 ? g -> numArcos : 1) * sizeof(int));
+    r -> ordemCoordenadas = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    ChaveVertice *chaves = (ChaveVertice *)malloc((n > 0 ? n : 1) * sizeof(ChaveVertice));
+    int *novoIndice = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+
+    if (!r -> frequencia || !r -> x || !r -> y || !r -> inicioArestas || !r -> destinos ||
+        !r -> ordemCoordenadas || !chaves || !novoIndice) {
+        free(chaves);
+        free(novoIndice);
+        return libertarGrafoCSR(r);
+    }
+
+    int minX = 0, minY = 0;
+    for (int v = 0; v < n; v++) {
+        if (v == 0 || g -> x[v] < minX) minX = g -> x[v];
+        if (v == 0 || g -> y[v] < minY) minY = g -> y[v];
+    }
+
+    for (int v = 0; v < n; v++) {
+        chaves[v].chave = indiceHilbert((uint32_t)((long long)g -> x[v] - minX), (uint32_t)((long long)g -> y[v] - minY));
+        chaves[v].vertice = v;
+    }
+    qsort(chaves, n, sizeof(ChaveVertice), compararChavesVertice);
+
+    for (int k = 0; k < n; k++) {
+        novoIndice[chaves[k].vertice] = k;
+    }
+
+    int a = 0;
+    for (int k = 0; k < n; k++) {
+
+        int v = chaves[k].vertice;
+        r -> frequencia[k] = g -> frequencia[v];
+        r -> x[k] = g -> x[v];
+        r -> y[k] = g -> y[v];
+        r -> inicioArestas[k] = a;
+
+        for (int e = g -> inicioArestas[v]; e < g -> inicioArestas[v + 1]; e++) {
+            r -> destinos[a++] = novoIndice[g -> destinos[e]];
+        }
+
+    }
+    r -> inicioArestas[n] = a;
+
+    for (int p = 0; p < n; p++) {
+        r -> ordemCoordenadas[p] = novoIndice[verticeOrdemCoordenadas(g, p)];
+    }
+
+    free(chaves);
+    free(novoIndice);
+
+    return r;
+
+}
+
+/**
+ * @brief Obtém o vértice que ocupa uma posição na ordem (x, y).
+ *
+ * @param g Grafo compacto.
+ * @param posicao Posição na ordem (x, y), entre 0 e numVertices - 1.
+ * @return Índice do vértice.
+ */
+
+int verticeOrdemCoordenadas(const GrafoCSR *g, int posicao) {
+
+    return g -> ordemCoordenadas ? g -> ordemCoordenadas[posicao] : posicao;
+
+}
+
+/**
+ * @brief Obtém o índice do vértice nas coordenadas (x, y).
+ *
+ * Usa procura binária, aproveitando a ordenação crescente por X e depois por Y
+ * (através de `ordemCoordenadas` nos grafos reordenados).
+ *
+ * @param g Grafo compacto.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Índice do vértice, ou -1 se não existir.
+ */
+
+int indiceVerticeCSR(const GrafoCSR *g, int x, int y) {
+
+    if (!g) {
+        return -1;
+    }
+
+    int baixo = 0, alto = g -> numVertices - 1;
+
+    while (baixo <= alto) {
+
+        int meio = baixo + (alto - baixo) / 2;
+        int v = verticeOrdemCoordenadas(g, meio);
+        int cx = g -> x[v];
+        int cy = g -> y[v];
+
+        if (cx == x && cy == y) {
+            return v;
+        }
+
+        if (cx < x || (cx == x && cy < y)) {
+            baixo = meio + 1;
+        } else {
+            alto = meio - 1;
+        }
+
+    }
+
+    return -1;
+
+}
+
+/**
+ * @brief Liberta toda a memória associada ao grafo compacto.
+ *
+ * @param g Grafo compacto.
+ * @return false após a libertação completa.
+ */
+
+GrafoCSR *libertarGrafoCSR(GrafoCSR *g) {
+
+    if (!g) {
+        return false;
+    }
+
+    free(g -> frequencia);
+    free(g -> x);
+    free(g -> y);
+    free(g -> inicioArestas);
+    free(g -> destinos);
+    free(g -> ordemCoordenadas);
+    free(g);
+
+    return false;
+
+}
+
+/**
+ * @brief Agrupa os vértices do grafo compacto por frequência.
+ *
+ * Ordenação por contagem estável: uma passagem para contar, outra para distribuir.
+ *
+ * @param g Grafo compacto.
+ * @return Grupos construídos (a libertar com `libertarGruposFrequencia`), ou false em caso de falha de memória.
+ */
+
+GruposFrequencia *agruparFrequenciasCSR(const GrafoCSR *g) {
+
+    if (!g) {
+        return false;
+    }
+
+    GruposFrequencia *gr = (GruposFrequencia *)calloc(1, sizeof(GruposFrequencia));
+    if (!gr) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    int nf = numFrequencias();
+    gr -> numFrequencias = nf;
+    gr -> inicio = (int *)calloc(nf + 1, sizeof(int));
+    gr -> vertices = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *posicao = (int *)malloc((nf > 0 ? nf : 1) * sizeof(int));
+
+    if (!gr -> inicio || !gr -> vertices || !posicao) {
+        free(posicao);
+        return libertarGruposFrequencia(gr);
+    }
+
+    for (int v = 0; v < n; v++) gr -> inicio[g -> frequencia[v] + 1]++;
+    for (int f = 0; f < nf; f++) gr -> inicio[f + 1] += gr -> inicio[f];
+    for (int f = 0; f < nf; f++) posicao[f] = gr -> inicio[f];
+    for (int v = 0; v < n; v++) gr -> vertices[posicao[g -> frequencia[v]]++] = v;
+
+    free(posicao);
+
+    return gr;
+
+}
+
+/**
+ * @brief Obtém os vértices de uma frequência.
+ *
+ * @param gr Grupos de frequência.
+ * @param frequencia Frequência pretendida.
+ * @param vertices Recebe o início do grupo (não alterado se o grupo estiver vazio).
+ * @return Número de vértices da frequência (0 se for desconhecida ou posterior ao agrupamento).
+ */
+
+int verticesFrequencia(const GruposFrequencia *gr, Frequencia frequencia, const int **vertices) {
+
+    if (!gr || frequencia >= gr -> numFrequencias) {
+        return 0;
+    }
+
+    *vertices = gr -> vertices + gr -> inicio[frequencia];
+
+    return gr -> inicio[frequencia + 1] - gr -> inicio[frequencia];
+
+}
+
+/**
+ * @brief Liberta os grupos de frequência.
+ *
+ * @param gr Grupos de frequência.
+ * @return false após a libertação completa.
+ */
+
+GruposFrequencia *libertarGruposFrequencia(GruposFrequencia *gr) {
+
+    if (!gr) {
+        return false;
+    }
+
+    free(gr -> inicio);
+    free(gr -> vertices);
+    free(gr);
+
+    return false;
+
+}
@@ -0,0 +1,72 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file grafocsr.h
+ * @author Thiago Abreu
+ * @brief Representação compacta (CSR) do grafo de antenas em vetores contíguos.
+ *
+ * O grafo dinâmico em listas ligadas é convertido numa forma de leitura rápida:
+ * cada vértice passa a ter um índice inteiro e as arestas ficam agrupadas por
+ * origem num único vetor. É a base para as procuras em lote e paralelas.
+ *
+ * Opcionalmente, `reordenarGrafoCSR` renumera os vértices ao longo da curva de
+ * Hilbert, para que antenas próximas no mapa (e, portanto, os extremos da maioria
+ * das arestas) fiquem próximas em memória durante as travessias.
+ */
+
+#ifndef GRAFOCSR_H
+#define GRAFOCSR_H
+
+#include <stdbool.h>
+#include "grafo.h"
+
+/**
+ * @struct GrafoCSR
+ * @brief Grafo em formato CSR (Compressed Sparse Row).
+ *
+ * As arestas do vértice `v` ocupam `destinos[inicioArestas[v]]` até
+ * `destinos[inicioArestas[v + 1] - 1]`. Os vértices seguem a ordem (x, y) da lista
+ * original, exceto depois de `reordenarGrafoCSR`: aí `ordemCoordenadas[r]` é o vértice
+ * que ocupa a posição `r` na ordem (x, y), e as procuras por coordenadas passam por ele.
+ */
+
+typedef struct GrafoCSR {
+    int numVertices;      /**< Número de vértices */
+    int numArcos;         /**< Número de entradas de adjacência (cada ligação conta nos dois sentidos) */
+    Frequencia *frequencia; /**< Frequência de cada vértice */
+    int *x, *y;           /**< Coordenadas de cada vértice */
+    int *inicioArestas;   /**< Início da adjacência de cada vértice (numVertices + 1 entradas) */
+    int *destinos;        /**< Índices dos vértices de destino, agrupados por origem */
+    int *ordemCoordenadas;/**< Vértices pela ordem (x, y), ou NULL se os índices já a seguem */
+} GrafoCSR;
+
+/**
+ * @struct GruposFrequencia
+ * @brief Vértices de um grafo compacto agrupados por frequência.
+ *
+ * Os vértices da frequência `f` ocupam `vertices[inicio[f]]` até
+ * `vertices[inicio[f + 1] - 1]`, por ordem crescente de índice.
+ */
+
+typedef struct GruposFrequencia {
+    int numFrequencias;   /**< Frequências registadas quando o agrupamento foi feito */
+    int *inicio;          /**< Início de cada frequência (numFrequencias + 1 entradas) */
+    int *vertices;        /**< Índices dos vértices, agrupados por frequência */
+} GruposFrequencia;
+
+GrafoCSR *construirGrafoCSR(Vertice *grafo);
+GrafoCSR *reordenarGrafoCSR(const GrafoCSR *g);
+int indiceVerticeCSR(const GrafoCSR *g, int x, int y);
+int verticeOrdemCoordenadas(const GrafoCSR *g, int posicao);
+GrafoCSR *libertarGrafoCSR(GrafoCSR *g);
+GruposFrequencia *agruparFrequenciasCSR(const GrafoCSR *g);
+int verticesFrequencia(const GruposFrequencia *gr, Frequencia frequencia, const int **vertices);
+GruposFrequencia *libertarGruposFrequencia(GruposFrequencia *gr);
+
+#endif
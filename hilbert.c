@@ -0,0 +1,52 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file hilbert.c
+ * @author Thiago Abreu
+ * @brief Cálculo da posição na curva de Hilbert de ordem 32.
+ */
+
+#include "hilbert.h"
+
+/**
+ * @brief Posição da célula (x, y) na curva de Hilbert que cobre 2^32 x 2^32 células.
+ *
+ * Percorre os bits do mais significativo para o menos: cada par de bits escolhe
+ * o quadrante e, nos quadrantes de baixo, as coordenadas restantes são rodadas
+ * para o sub-quadrado seguir a orientação da curva.
+ *
+ * @param x Coordenada X (não negativa; o chamador desloca as coordenadas se preciso).
+ * @param y Coordenada Y.
+ * @return Posição na curva (entre 0 e 4^32 - 1).
+ */
+
+uint64_t indiceHilbert(uint32_t x, uint32_t y) {
+
+    uint64_t d = 0;
+
+    for (uint32_t s = 1u << 31; s > 0; s >>= 1) {
+
+        uint32_t rx = (x & s) ? 1 : 0;
+        uint32_t ry = (y & s) ? 1 : 0;
+        d += (uint64_t)s * s * ((3 * rx) ^ ry);
+
+        if (ry == 0) {
+            if (rx == 1) {
+                x = ~x;
+                y = ~y;
+            }
+            uint32_t t = x;
+            x = y;
+            y = t;
+        }
+
+    }
+
+    return d;
+
+}
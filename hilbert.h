@@ -0,0 +1,25 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file hilbert.h
+ * @author Thiago Abreu
+ * @brief Posição de uma célula ao longo da curva de Hilbert, para ordenar dados por proximidade.
+ *
+ * Células vizinhas no mapa ficam quase sempre próximas na curva, ao contrário da
+ * ordem (x, y), em que duas linhas adjacentes estão a uma linha inteira de distância.
+ */
+
+#ifndef HILBERT_H
+#define HILBERT_H
+
+#include <stdint.h>
+
+uint64_t indiceHilbert(uint32_t x, uint32_t y);
+
+#endif
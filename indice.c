@@ -0,0 +1,310 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file indice.c
+ * @author Thiago Abreu
+ * @brief Implementação do índice de coordenadas.
+ *
+ * A tabela tem pelo menos o dobro das entradas dos vértices (carga <= 0.5) e
+ * resolve colisões por sondagem linear; a remoção desloca para trás as entradas
+ * seguintes do mesmo agrupamento, pelo que não são precisas marcas de apagado.
+ * Alterações feitas ao grafo sem passar por este módulo exigem reconstruir o índice.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "indice.h"
+
+/**
+ * @brief Posição inicial das coordenadas (x, y) na tabela.
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param capacidade Tamanho da tabela (potência de 2).
+ * @return Posição na tabela.
+ */
+
+static int dispersaoCoordenadas(int x, int y, int capacidade) {
+
+    uint64_t h = ((uint64_t)(uint32_t)x << 32 | (uint32_t)y) * 0x9E3779B97F4A7C15ULL;
+
+    return (int)((h >> 32) & (uint64_t)(capacidade - 1));
+
+}
+
+/**
+ * @brief Constrói o índice com todos os vértices do grafo.
+ *
+ * Se houver vértices repetidos na mesma célula, fica indexado o primeiro da lista.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @return Índice construído, ou false em caso de falha de memória.
+ */
+
+IndiceCoordenadas *construirIndiceCoordenadas(Vertice *grafo) {
+
+    IndiceCoordenadas *ind = (IndiceCoordenadas *)calloc(1, sizeof(IndiceCoordenadas));
+    if (!ind) {
+        return false;
+    }
+
+    int n = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) n++;
+
+    ind -> capacidade = 16;
+    while (ind -> capacidade < 2 * n) ind -> capacidade *= 2;
+
+    ind -> vertices = (Vertice **)calloc(ind -> capacidade, sizeof(Vertice *));
+    if (!ind -> vertices) {
+        return libertarIndiceCoordenadas(ind);
+    }
+
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+
+        int p = dispersaoCoordenadas(v -> x, v -> y, ind -> capacidade);
+        bool repetido = false;
+
+        while (ind -> vertices[p]) {
+            if (ind -> vertices[p] -> x == v -> x && ind -> vertices[p] -> y == v -> y) {
+                repetido = true;
+                break;
+            }
+            p = (p + 1) & (ind -> capacidade - 1);
+        }
+
+        if (!repetido) {
+            ind -> vertices[p] = v;
+            ind -> numVertices++;
+        }
+
+    }
+
+    return ind;
+
+}
+
+/**
+ * @brief Obtém a entrada da tabela ocupada pelo vértice em (x, y).
+ *
+ * A entrada identifica o vértice enquanto o índice não for alterado, podendo
+ * servir de posição num vetor auxiliar com `capacidade` elementos.
+ *
+ * @param ind Índice de coordenadas.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Posição na tabela, ou -1 se a célula estiver vazia.
+ */
+
+int entradaIndice(const IndiceCoordenadas *ind, int x, int y) {
+
+    if (!ind) {
+        return -1;
+    }
+
+    int p = dispersaoCoordenadas(x, y, ind -> capacidade);
+
+    while (ind -> vertices[p]) {
+        if (ind -> vertices[p] -> x == x && ind -> vertices[p] -> y == y) {
+            return p;
+        }
+        p = (p + 1) & (ind -> capacidade - 1);
+    }
+
+    return -1;
+
+}
+
+/**
+ * @brief Obtém o vértice nas coordenadas (x, y).
+ *
+ * @param ind Índice de coordenadas.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Vértice encontrado, ou NULL se a célula estiver vazia.
+ */
+
+Vertice *verticeEm(const IndiceCoordenadas *ind, int x, int y) {
+
+    int p = entradaIndice(ind, x, y);
+
+    return p >= 0 ? ind -> vertices[p] : NULL;
+
+}
+
+/**
+ * @brief Acrescenta um vértice ao índice, duplicando a tabela quando a carga passa de 0.5.
+ *
+ * @param ind Índice de coordenadas.
+ * @param v Vértice a indexar.
+ * @return true se o vértice foi indexado, false se a célula já estava ocupada ou faltou memória.
+ */
+
+bool indexarVertice(IndiceCoordenadas *ind, Vertice *v) {
+
+    if (!ind || !v || verticeEm(ind, v -> x, v -> y)) {
+        return false;
+    }
+
+    if (2 * (ind -> numVertices + 1) > ind -> capacidade) {
+
+        int capacidade = ind -> capacidade * 2;
+        Vertice **vertices = (Vertice **)calloc(capacidade, sizeof(Vertice *));
+        if (!vertices) {
+            return false;
+        }
+
+        for (int i = 0; i < ind -> capacidade; i++) {
+            Vertice *u = ind -> vertices[i];
+            if (!u) continue;
+            int p = dispersaoCoordenadas(u -> x, u -> y, capacidade);
+            while (vertices[p]) p = (p + 1) & (capacidade - 1);
+            vertices[p] = u;
+        }
+
+        free(ind -> vertices);
+        ind -> vertices = vertices;
+        ind -> capacidade = capacidade;
+
+    }
+
+    int p = dispersaoCoordenadas(v -> x, v -> y, ind -> capacidade);
+    while (ind -> vertices[p]) p = (p + 1) & (ind -> capacidade - 1);
+    ind -> vertices[p] = v;
+    ind -> numVertices++;
+
+    return true;
+
+}
+
+/**
+ * @brief Retira do índice o vértice das coordenadas (x, y).
+ *
+ * @param ind Índice de coordenadas.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se havia um vértice indexado nessa célula.
+ */
+
+bool desindexarVertice(IndiceCoordenadas *ind, int x, int y) {
+
+    if (!ind) {
+        return false;
+    }
+
+    int mascara = ind -> capacidade - 1;
+    int p = dispersaoCoordenadas(x, y, ind -> capacidade);
+
+    while (ind -> vertices[p] && !(ind -> vertices[p] -> x == x && ind -> vertices[p] -> y == y)) {
+        p = (p + 1) & mascara;
+    }
+
+    if (!ind -> vertices[p]) {
+        return false;
+    }
+
+    // Desloca para trás as entradas que deixariam de ser encontradas
+    int livre = p;
+    for (int q = (p + 1) & mascara; ind -> vertices[q]; q = (q + 1) & mascara) {
+        int inicial = dispersaoCoordenadas(ind -> vertices[q] -> x, ind -> vertices[q] -> y, ind -> capacidade);
+        if (((q - inicial) & mascara) >= ((q - livre) & mascara)) {
+            ind -> vertices[livre] = ind -> vertices[q];
+            livre = q;
+        }
+    }
+    ind -> vertices[livre] = NULL;
+    ind -> numVertices--;
+
+    return true;
+
+}
+
+/**
+ * @brief Insere um vértice no grafo e no índice.
+ *
+ * O duplicado é detetado no índice em O(1); o encadeamento na lista ordenada
+ * continua a custar O(posição).
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param ind Índice de coordenadas do grafo.
+ * @param frequencia Frequência da antena.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param inserido Indica se o vértice foi inserido (pode ser NULL).
+ * @return Apontador para o início atualizado da lista.
+ */
+
+Vertice *inserirVerticeIndexado(Vertice *grafo, IndiceCoordenadas *ind, Frequencia frequencia, int x, int y, bool *inserido) {
+
+    if (inserido) *inserido = false;
+
+    if (!ind || verticeEm(ind, x, y)) {
+        return grafo;
+    }
+
+    Vertice *novo = criarVertice(frequencia, x, y);
+    if (!novo) {
+        return grafo;
+    }
+
+    if (!indexarVertice(ind, novo)) {
+        free(novo);
+        return grafo;
+    }
+
+    if (inserido) *inserido = true;
+
+    return encadearVertice(grafo, novo);
+
+}
+
+/**
+ * @brief Remove do grafo e do índice o vértice das coordenadas (x, y), em O(grau).
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param ind Índice de coordenadas do grafo.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param removido Indica se havia um vértice nessa célula (pode ser NULL).
+ * @return Apontador para o início atualizado da lista.
+ */
+
+Vertice *removerVerticeIndexado(Vertice *grafo, IndiceCoordenadas *ind, int x, int y, bool *removido) {
+
+    Vertice *v = verticeEm(ind, x, y);
+
+    if (removido) *removido = v != NULL;
+
+    if (!v) {
+        return grafo;
+    }
+
+    desindexarVertice(ind, x, y);
+
+    return removerVertice(grafo, v);
+
+}
+
+/**
+ * @brief Liberta o índice (os vértices não são libertados).
+ *
+ * @param ind Índice de coordenadas.
+ * @return false após a libertação.
+ */
+
+IndiceCoordenadas *libertarIndiceCoordenadas(IndiceCoordenadas *ind) {
+
+    if (!ind) {
+        return false;
+    }
+
+    free(ind -> vertices);
+    free(ind);
+
+    return false;
+
+}
@@ -0,0 +1,45 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file indice.h
+ * @author Thiago Abreu
+ * @brief Índice de coordenadas: localiza o vértice de uma célula em tempo constante.
+ *
+ * Substitui a procura linear na lista de vértices (como a de `conectarVertices`)
+ * por uma tabela de dispersão aberta indexada por (x, y). As operações
+ * `inserirVerticeIndexado` e `removerVerticeIndexado` alteram o grafo e o índice
+ * em conjunto, mantendo-os coerentes.
+ */
+
+#ifndef INDICE_H
+#define INDICE_H
+
+#include "grafo.h"
+
+/**
+ * @struct IndiceCoordenadas
+ * @brief Tabela de dispersão aberta de coordenadas para vértices.
+ */
+
+typedef struct IndiceCoordenadas {
+    int capacidade;          /**< Tamanho da tabela (potência de 2) */
+    int numVertices;         /**< Vértices indexados */
+    Vertice **vertices;      /**< Vértice de cada entrada (NULL se livre) */
+} IndiceCoordenadas;
+
+IndiceCoordenadas *construirIndiceCoordenadas(Vertice *grafo);
+Vertice *verticeEm(const IndiceCoordenadas *ind, int x, int y);
+int entradaIndice(const IndiceCoordenadas *ind, int x, int y);
+bool indexarVertice(IndiceCoordenadas *ind, Vertice *v);
+bool desindexarVertice(IndiceCoordenadas *ind, int x, int y);
+Vertice *inserirVerticeIndexado(Vertice *grafo, IndiceCoordenadas *ind, Frequencia frequencia, int x, int y, bool *inserido);
+Vertice *removerVerticeIndexado(Vertice *grafo, IndiceCoordenadas *ind, int x, int y, bool *removido);
+IndiceCoordenadas *libertarIndiceCoordenadas(IndiceCoordenadas *ind);
+
+#endif
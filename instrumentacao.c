@@ -0,0 +1,196 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file instrumentacao.c
+ * @author Thiago Abreu
+ * @brief Implementação dos contadores e do relatório em JSON.
+ *
+ * Os contadores são atómicos com ordem relaxada, para poderem ser atualizados
+ * pelas threads do conjunto partilhado. A profundidade de recursão é seguida por
+ * thread. O relatório é escrito à saída do programa através de `atexit`.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "instrumentacao.h"
+
+/** true depois de `iniciarInstrumentacao` ter sucesso. */
+bool instrumentacaoAtiva = false;
+
+/** Nomes dos contadores no relatório, pela ordem de `Contador`. */
+static const char *nomesContadores[NUM_CONTADORES] = {
+    "nos_inserir_antena",
+    "nos_existe_posicao",
+    "alocacoes_antena",
+    "alocacoes_coordenada",
+    "alocacoes_vertice",
+    "alocacoes_aresta",
+    "alocacoes_fila",
+    "largura_vertices",
+    "largura_arestas",
+    "profundidade_vertices",
+    "profundidade_arestas",
+    "caminhos_chamadas",
+    "caminhos_profundidade_maxima",
+    "nefastos_pares_testados"
+};
+
+/** Nomes dos cronómetros no relatório, pela ordem de `Cronometro`. */
+static const char *nomesCronometros[NUM_CRONOMETROS] = {
+    "carregarAntenas",
+    "detectarLocaisNefastos",
+    "procuraLargura",
+    "procuraProfundidade",
+    "caminhosEntreAntenas"
+};
+
+static _Atomic long contadores[NUM_CONTADORES];
+static _Atomic long chamadas[NUM_CRONOMETROS];
+static _Atomic long long nanossegundos[NUM_CRONOMETROS];
+static _Thread_local long profundidadeAtual;
+
+/** Ficheiro do relatório (vazio ou "-" escreve para stderr). */
+static char ficheiroRelatorio[256];
+
+/**
+ * @brief Escreve o relatório no ficheiro escolhido em `iniciarInstrumentacao`.
+ */
+
+static void relatorioSaida(void) {
+
+    escreverRelatorioInstrumentacao(ficheiroRelatorio);
+
+}
+
+/**
+ * @brief Ativa a recolha e agenda o relatório para a saída do programa.
+ *
+ * @param ficheiro Ficheiro do relatório JSON (NULL, vazio ou "-" usa stderr).
+ * @return true se a instrumentação ficou ativa, false se o programa foi compilado sem ela.
+ */
+
+bool iniciarInstrumentacao(const char *ficheiro) {
+
+#ifdef INSTRUMENTACAO
+    if (instrumentacaoAtiva) {
+        return true;
+    }
+
+    snprintf(ficheiroRelatorio, sizeof(ficheiroRelatorio), "%s", ficheiro ? ficheiro : "");
+    instrumentacaoAtiva = true;
+    atexit(relatorioSaida);
+
+    return true;
+#else
+    (void)ficheiro;
+    (void)relatorioSaida;
+    return false;
+#endif
+
+}
+
+/**
+ * @brief Soma uma quantidade a um contador.
+ *
+ * @param c Contador.
+ * @param quantidade Valor a somar.
+ */
+
+void somarContador(Contador c, long quantidade) {
+
+    atomic_fetch_add_explicit(&contadores[c], quantidade, memory_order_relaxed);
+
+}
+
+/**
+ * @brief Atualiza um contador que guarda o maior valor observado.
+ *
+ * @param c Contador.
+ * @param valor Valor observado.
+ */
+
+void registarMaximo(Contador c, long valor) {
+
+    long atual = atomic_load_explicit(&contadores[c], memory_order_relaxed);
+    while (valor > atual &&
+           !atomic_compare_exchange_weak_explicit(&contadores[c], &atual, valor, memory_order_relaxed, memory_order_relaxed)) {
+    }
+
+}
+
+/**
+ * @brief Entra num nível de recursão da thread atual.
+ *
+ * @param maximo Contador onde registar a profundidade máxima.
+ */
+
+void entrarRecursao(Contador maximo) {
+
+    registarMaximo(maximo, ++profundidadeAtual);
+
+}
+
+/**
+ * @brief Sai de um nível de recursão da thread atual.
+ */
+
+void sairRecursao(void) {
+
+    if (profundidadeAtual > 0) profundidadeAtual--;
+
+}
+
+/**
+ * @brief Acumula uma chamada e a sua duração num cronómetro.
+ *
+ * @param c Cronómetro.
+ * @param segundos Duração da chamada.
+ */
+
+void somarTempo(Cronometro c, double segundos) {
+
+    atomic_fetch_add_explicit(&chamadas[c], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&nanossegundos[c], (long long)(segundos * 1e9), memory_order_relaxed);
+
+}
+
+/**
+ * @brief Escreve o relatório JSON com todos os contadores e cronómetros.
+ *
+ * @param ficheiro Ficheiro de destino (NULL, vazio ou "-" usa stderr).
+ * @return true se o relatório foi escrito.
+ */
+
+bool escreverRelatorioInstrumentacao(const char *ficheiro) {
+
+    bool consola = !ficheiro || ficheiro[0] == '\0' || strcmp(ficheiro, "-") == 0;
+    FILE *f = consola ? stderr : fopen(ficheiro, "w");
+    if (!f) {
+        return false;
+    }
+
+    fprintf(f, "{\n  \"contadores\": {\n");
+    for (int c = 0; c < NUM_CONTADORES; c++) {
+        fprintf(f, "    \"%s\": %ld%s\n", nomesContadores[c],
+                atomic_load(&contadores[c]), c + 1 < NUM_CONTADORES ? "," : "");
+    }
+
+    fprintf(f, "  },\n  \"tempos\": {\n");
+    for (int c = 0; c < NUM_CRONOMETROS; c++) {
+        fprintf(f, "    \"%s\": { \"chamadas\": %ld, \"segundos\": %.6f }%s\n", nomesCronometros[c],
+                atomic_load(&chamadas[c]), atomic_load(&nanossegundos[c]) / 1e9, c + 1 < NUM_CRONOMETROS ? "," : "");
+    }
+    fprintf(f, "  }\n}\n");
+
+    if (!consola) fclose(f);
+
+    return true;
+
+}
@@ -0,0 +1,101 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file instrumentacao.h
+ * @author Thiago Abreu
+ * @brief Contadores e tempos dos pontos críticos, com relatório em JSON.
+ *
+ * As macros `INSTR_*` só geram código quando o programa é compilado com
+ * `-DINSTRUMENTACAO`; caso contrário são expressões vazias e não têm custo.
+ * Mesmo compilada, a recolha só acontece depois de `iniciarInstrumentacao`
+ * (opção `--instrumentacao` ou variável de ambiente `EDA_INSTRUMENTACAO`).
+ */
+
+#ifndef INSTRUMENTACAO_H
+#define INSTRUMENTACAO_H
+
+#include <stdbool.h>
+
+/**
+ * @enum Contador
+ * @brief Contadores recolhidos pela instrumentação.
+ */
+
+typedef enum Contador {
+    CONTADOR_NOS_INSERIR_ANTENA,        /**< Nós percorridos em inserirAntena */
+    CONTADOR_NOS_EXISTE_POSICAO,        /**< Nós percorridos em existePosicao */
+    CONTADOR_ALOC_ANTENA,               /**< Alocações de Antena */
+    CONTADOR_ALOC_COORDENADA,           /**< Alocações de Coordenada */
+    CONTADOR_ALOC_VERTICE,              /**< Alocações de Vertice */
+    CONTADOR_ALOC_ARESTA,               /**< Alocações de Aresta */
+    CONTADOR_ALOC_FILA,                 /**< Alocações de FilaVertice */
+    CONTADOR_LARGURA_VERTICES,          /**< Vértices retirados da fila em procuraLargura */
+    CONTADOR_LARGURA_ARESTAS,           /**< Arestas examinadas em procuraLargura */
+    CONTADOR_PROFUNDIDADE_VERTICES,     /**< Vértices visitados em procuraProfundidade */
+    CONTADOR_PROFUNDIDADE_ARESTAS,      /**< Arestas examinadas em procuraProfundidade */
+    CONTADOR_CAMINHOS_CHAMADAS,         /**< Chamadas de buscarCaminhos que expandem um vértice */
+    CONTADOR_CAMINHOS_PROFUNDIDADE_MAX, /**< Profundidade máxima de recursão de buscarCaminhos */
+    CONTADOR_PARES_NEFASTOS,            /**< Pares de antenas testados em detectarLocaisNefastos */
+    NUM_CONTADORES
+} Contador;
+
+/**
+ * @enum Cronometro
+ * @brief Funções cujo tempo total é medido.
+ */
+
+typedef enum Cronometro {
+    CRONOMETRO_CARREGAR_ANTENAS,
+    CRONOMETRO_NEFASTOS,
+    CRONOMETRO_PROCURA_LARGURA,
+    CRONOMETRO_PROCURA_PROFUNDIDADE,
+    CRONOMETRO_CAMINHOS,
+    NUM_CRONOMETROS
+} Cronometro;
+
+extern bool instrumentacaoAtiva;
+
+bool iniciarInstrumentacao(const char *ficheiro);
+void somarContador(Contador c, long quantidade);
+void registarMaximo(Contador c, long valor);
+void entrarRecursao(Contador maximo);
+void sairRecursao(void);
+void somarTempo(Cronometro c, double segundos);
+bool escreverRelatorioInstrumentacao(const char *ficheiro);
+
+#ifdef INSTRUMENTACAO
+
+#include "tempo.h"
+
+/** Soma `n` ao contador `c`. */
+#define INSTR_CONTAR(c, n) do { if (instrumentacaoAtiva) somarContador((c), (n)); } while (0)
+
+/** Marca a entrada num nível de recursão, atualizando a profundidade máxima em `c`. */
+#define INSTR_ENTRAR(c) do { if (instrumentacaoAtiva) entrarRecursao(c); } while (0)
+
+/** Marca a saída de um nível de recursão. */
+#define INSTR_SAIR() do { if (instrumentacaoAtiva) sairRecursao(); } while (0)
+
+/** Declara `var` com o instante atual, para uso com INSTR_FIM. */
+#define INSTR_INICIO(var) double var = instrumentacaoAtiva ? tempoAtual() : 0.0
+
+/** Soma ao cronómetro `c` o tempo decorrido desde INSTR_INICIO(var). */
+#define INSTR_FIM(c, var) do { if (instrumentacaoAtiva) somarTempo((c), tempoAtual() - (var)); } while (0)
+
+#else
+
+#define INSTR_CONTAR(c, n) ((void)0)
+#define INSTR_ENTRAR(c) ((void)0)
+#define INSTR_SAIR() ((void)0)
+#define INSTR_INICIO(var) ((void)0)
+#define INSTR_FIM(c, var) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,346 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file interferencia.c
+ * @author Thiago Abreu
+ * @brief Construção e consulta do índice inverso dos locais nefastos.
+ *
+ * As antenas são agrupadas por frequência (ordenação por contagem estável) e cada
+ * par que gera um ponto médio produz uma entrada (local, par). As entradas são
+ * ordenadas pelo local, o que deixa as causas de cada local contíguas; basta então
+ * registar onde começa cada local e inseri-lo na tabela de dispersão.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "interferencia.h"
+#include "funcoes.h"
+
+/**
+ * @struct EntradaInterferencia
+ * @brief Local nefasto gerado por um par, antes da ordenação.
+ */
+
+typedef struct EntradaInterferencia {
+    long long chave;   /**< Coordenadas do local codificadas por (x, y) */
+    ParAntenas par;    /**< Par que gera o local */
+} EntradaInterferencia;
+
+/**
+ * @brief Codifica uma coordenada numa chave ordenável por (x, y).
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Chave da coordenada.
+ */
+
+static long long chaveLocal(int x, int y) {
+
+    // Inverter o bit de sinal de y torna a comparação com sinal da chave igual à ordem (x, y)
+    return (long long)((((unsigned long long)(unsigned int)x << 32) | (unsigned int)y) ^ 0x80000000ULL);
+
+}
+
+/**
+ * @brief Dispersão de uma chave para a tabela.
+ *
+ * @param chave Chave do local.
+ * @param capacidade Tamanho da tabela (potência de 2).
+ * @return Posição inicial na tabela.
+ */
+
+static int dispersao(long long chave, int capacidade) {
+
+    uint64_t h = (uint64_t)chave * 0x9E3779B97F4A7C15ULL;
+
+    return (int)((h >> 32) & (uint64_t)(capacidade - 1));
+
+}
+
+/**
+ * @brief Compara duas entradas pelo local e depois pelo par, para `qsort`.
+ *
+ * @param a Primeira entrada.
+ * @param b Segunda entrada.
+ * @return Negativo, zero ou positivo.
+ */
+
+static int compararEntradas(const void *a, const void *b) {
+
+    const EntradaInterferencia *p = (const EntradaInterferencia *)a;
+    const EntradaInterferencia *q = (const EntradaInterferencia *)b;
+
+    if (p -> chave != q -> chave) return p -> chave < q -> chave ? -1 : 1;
+    if (p -> par.a != q -> par.a) return p -> par.a < q -> par.a ? -1 : 1;
+
+    return (p -> par.b > q -> par.b) - (p -> par.b < q -> par.b);
+
+}
+
+/**
+ * @brief Deteta os locais nefastos e constrói o índice das suas causas.
+ *
+ * Usa a mesma regra de `detectarLocaisNefastos`: cada par de antenas da mesma
+ * frequência com diferenças pares em X e em Y gera o seu ponto médio.
+ *
+ * @param lista Lista ligada de antenas.
+ * @return Índice construído (com 0 locais se não houver nenhum), ou false em caso de falha de memória.
+ */
+
+IndiceInterferencia *construirIndiceInterferencia(Antena *lista) {
+
+    IndiceInterferencia *indice = (IndiceInterferencia *)calloc(1, sizeof(IndiceInterferencia));
+    if (!indice) {
+        return false;
+    }
+
+    int nf = numFrequencias();
+    int *contagem = (int *)calloc(nf + 1, sizeof(int));
+    int *posicao = (int *)malloc((nf > 0 ? nf : 1) * sizeof(int));
+    if (!contagem || !posicao) {
+        free(contagem);
+        free(posicao);
+        return libertarIndiceInterferencia(indice);
+    }
+
+    int n = 0;
+    for (Antena *a = lista; a; a = a -> proximo) {
+        n++;
+        contagem[a -> frequencia + 1]++;
+    }
+
+    indice -> numAntenas = n;
+    indice -> frequencia = (Frequencia *)malloc((n > 0 ? n : 1) * sizeof(Frequencia));
+    indice -> antenaX = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    indice -> antenaY = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *ordem = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+
+    if (!indice -> frequencia || !indice -> antenaX || !indice -> antenaY || !ordem) {
+        free(ordem);
+        free(contagem);
+        free(posicao);
+        return libertarIndiceInterferencia(indice);
+    }
+
+    // Copia as antenas e agrupa-as por frequência, mantendo a ordem da lista em cada grupo
+    for (int f = 0; f < nf; f++) contagem[f + 1] += contagem[f];
+    memcpy(posicao, contagem, nf * sizeof(int));
+
+    int i = 0;
+    for (Antena *a = lista; a; a = a -> proximo, i++) {
+        indice -> frequencia[i] = a -> frequencia;
+        indice -> antenaX[i] = a -> x;
+        indice -> antenaY[i] = a -> y;
+        ordem[posicao[a -> frequencia]++] = i;
+    }
+
+    // Gera uma entrada por par que produz um local nefasto
+    long capacidade = 1024, numEntradas = 0;
+    EntradaInterferencia *entradas = (EntradaInterferencia *)malloc(capacidade * sizeof(EntradaInterferencia));
+    if (!entradas) {
+        free(ordem);
+        free(contagem);
+        free(posicao);
+        return libertarIndiceInterferencia(indice);
+    }
+
+    for (int f = 0; f < nf; f++) {
+        for (int p = contagem[f]; p < contagem[f + 1]; p++) {
+            for (int q = p + 1; q < contagem[f + 1]; q++) {
+
+                int a = ordem[p], b = ordem[q];
+                int dx = indice -> antenaX[b] - indice -> antenaX[a];
+                int dy = indice -> antenaY[b] - indice -> antenaY[a];
+                if (dx % 2 != 0 || dy % 2 != 0) continue;
+
+                if (numEntradas == capacidade) {
+                    EntradaInterferencia *maior = (EntradaInterferencia *)realloc(entradas, 2 * capacidade * sizeof(EntradaInterferencia));
+                    if (!maior) {
+                        free(entradas);
+                        free(ordem);
+                        free(contagem);
+                        free(posicao);
+                        return libertarIndiceInterferencia(indice);
+                    }
+                    entradas = maior;
+                    capacidade *= 2;
+                }
+
+                entradas[numEntradas].chave = chaveLocal(indice -> antenaX[a] + dx / 2, indice -> antenaY[a] + dy / 2);
+                entradas[numEntradas].par.a = a;
+                entradas[numEntradas].par.b = b;
+                numEntradas++;
+
+            }
+        }
+    }
+    free(ordem);
+    free(contagem);
+    free(posicao);
+
+    qsort(entradas, numEntradas, sizeof(EntradaInterferencia), compararEntradas);
+
+    int locais = 0;
+    for (long e = 0; e < numEntradas; e++) {
+        if (e == 0 || entradas[e].chave != entradas[e - 1].chave) locais++;
+    }
+
+    int tabela = 16;
+    while (tabela < 2 * locais) tabela *= 2;
+
+    indice -> numLocais = locais;
+    indice -> localX = (int *)malloc((locais > 0 ? locais : 1) * sizeof(int));
+    indice -> localY = (int *)malloc((locais > 0 ? locais : 1) * sizeof(int));
+    indice -> inicioPares = (long *)malloc((locais + 1) * sizeof(long));
+    indice -> pares = (ParAntenas *)malloc((numEntradas > 0 ? numEntradas : 1) * sizeof(ParAntenas));
+    indice -> capacidadeTabela = tabela;
+    indice -> tabela = (int *)malloc(tabela * sizeof(int));
+
+    if (!indice -> localX || !indice -> localY || !indice -> inicioPares || !indice -> pares || !indice -> tabela) {
+        free(entradas);
+        return libertarIndiceInterferencia(indice);
+    }
+
+    for (int t = 0; t < tabela; t++) indice -> tabela[t] = -1;
+
+    int c = -1;
+    for (long e = 0; e < numEntradas; e++) {
+
+        if (e == 0 || entradas[e].chave != entradas[e - 1].chave) {
+
+            c++;
+            unsigned long long k = (unsigned long long)entradas[e].chave ^ 0x80000000ULL;
+            indice -> localX[c] = (int)(unsigned int)(k >> 32);
+            indice -> localY[c] = (int)(unsigned int)k;
+            indice -> inicioPares[c] = e;
+
+            int t = dispersao(entradas[e].chave, tabela);
+            while (indice -> tabela[t] >= 0) t = (t + 1) & (tabela - 1);
+            indice -> tabela[t] = c;
+
+        }
+
+        indice -> pares[e] = entradas[e].par;
+
+    }
+    indice -> inicioPares[locais] = numEntradas;
+
+    free(entradas);
+
+    return indice;
+
+}
+
+/**
+ * @brief Obtém o número do local nefasto nas coordenadas (x, y).
+ *
+ * @param indice Índice de interferência.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Número do local, ou -1 se (x, y) não for um local nefasto.
+ */
+
+int localInterferencia(const IndiceInterferencia *indice, int x, int y) {
+
+    if (!indice || indice -> numLocais == 0) {
+        return -1;
+    }
+
+    int t = dispersao(chaveLocal(x, y), indice -> capacidadeTabela);
+
+    while (indice -> tabela[t] >= 0) {
+        int c = indice -> tabela[t];
+        if (indice -> localX[c] == x && indice -> localY[c] == y) return c;
+        t = (t + 1) & (indice -> capacidadeTabela - 1);
+    }
+
+    return -1;
+
+}
+
+/**
+ * @brief Obtém os pares de antenas que causam o local nefasto (x, y).
+ *
+ * @param indice Índice de interferência.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param numPares Recebe o número de pares (0 se o local não for nefasto).
+ * @return Primeiro par causador, ou NULL se o local não for nefasto.
+ */
+
+const ParAntenas *causasNefasto(const IndiceInterferencia *indice, int x, int y, long *numPares) {
+
+    int c = localInterferencia(indice, x, y);
+    if (c < 0) {
+        *numPares = 0;
+        return NULL;
+    }
+
+    *numPares = indice -> inicioPares[c + 1] - indice -> inicioPares[c];
+
+    return &indice -> pares[indice -> inicioPares[c]];
+
+}
+
+/**
+ * @brief Devolve os locais nefastos do índice como lista de coordenadas.
+ *
+ * @param indice Índice de interferência.
+ * @return Lista ordenada por (x, y), com o mesmo conjunto de `detectarLocaisNefastos`,
+ *         ou NULL se não houver nenhum local ou faltar memória.
+ */
+
+Coordenada *locaisInterferencia(const IndiceInterferencia *indice) {
+
+    Coordenada *lista = NULL;
+
+    for (int c = indice ? indice -> numLocais - 1 : -1; c >= 0; c--) {
+
+        Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+        if (!nova) {
+            return libertarCoordenadas(lista);
+        }
+
+        nova -> x = indice -> localX[c];
+        nova -> y = indice -> localY[c];
+        nova -> proximo = lista;
+        lista = nova;
+
+    }
+
+    return lista;
+
+}
+
+/**
+ * @brief Liberta toda a memória associada ao índice.
+ *
+ * @param indice Índice de interferência.
+ * @return false após a libertação completa.
+ */
+
+IndiceInterferencia *libertarIndiceInterferencia(IndiceInterferencia *indice) {
+
+    if (!indice) {
+        return false;
+    }
+
+    free(indice -> frequencia);
+    free(indice -> antenaX);
+    free(indice -> antenaY);
+    free(indice -> localX);
+    free(indice -> localY);
+    free(indice -> inicioPares);
+    free(indice -> pares);
+    free(indice -> tabela);
+    free(indice);
+
+    return false;
+
+}
@@ -0,0 +1,60 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file interferencia.h
+ * @author Thiago Abreu
+ * @brief Índice inverso dos locais nefastos: que pares de antenas causam cada local.
+ *
+ * O índice é construído na própria deteção e guarda, para cada local nefasto, a
+ * lista dos pares de antenas da mesma frequência cujo ponto médio é esse local.
+ * As listas estão contíguas num único vetor (formato CSR) e cada local é
+ * encontrado por uma tabela de dispersão, pelo que a consulta é O(1).
+ */
+
+#ifndef INTERFERENCIA_H
+#define INTERFERENCIA_H
+
+#include "antenas.h"
+
+/**
+ * @struct ParAntenas
+ * @brief Par de antenas, por índice nos vetores de antenas do índice.
+ */
+
+typedef struct ParAntenas {
+    int a, b;   /**< Índices das duas antenas (a aparece antes de b na lista original) */
+} ParAntenas;
+
+/**
+ * @struct IndiceInterferencia
+ * @brief Locais nefastos e respetivas causas.
+ *
+ * As causas do local `c` são `pares[inicioPares[c]]` até `pares[inicioPares[c + 1] - 1]`.
+ * Os locais estão ordenados por (x, y).
+ */
+
+typedef struct IndiceInterferencia {
+    int numAntenas;          /**< Número de antenas copiadas da lista */
+    Frequencia *frequencia;  /**< Frequência de cada antena */
+    int *antenaX, *antenaY;  /**< Coordenadas de cada antena */
+    int numLocais;           /**< Número de locais nefastos */
+    int *localX, *localY;    /**< Coordenadas de cada local nefasto */
+    long *inicioPares;       /**< Início das causas de cada local (numLocais + 1 entradas) */
+    ParAntenas *pares;       /**< Pares causadores, agrupados por local */
+    int capacidadeTabela;    /**< Tamanho da tabela de dispersão (potência de 2) */
+    int *tabela;             /**< Tabela de dispersão coordenada -> local (-1 se vazia) */
+} IndiceInterferencia;
+
+IndiceInterferencia *construirIndiceInterferencia(Antena *lista);
+int localInterferencia(const IndiceInterferencia *indice, int x, int y);
+const ParAntenas *causasNefasto(const IndiceInterferencia *indice, int x, int y, long *numPares);
+Coordenada *locaisInterferencia(const IndiceInterferencia *indice);
+IndiceInterferencia *libertarIndiceInterferencia(IndiceInterferencia *indice);
+
+#endif
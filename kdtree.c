@@ -0,0 +1,712 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file kdtree.c
+ * @author Thiago Abreu
+ * @brief Implementação da árvore k-d das antenas.
+ *
+ * A construção coloca a mediana de cada intervalo no seu centro por seleção
+ * (quickselect), em O(n log n) no caso esperado e sem apontadores entre nós.
+ * As procuras descem primeiro pelo lado do ponto consultado e só visitam o
+ * outro lado quando o plano de divisão está mais perto do que o pior candidato.
+ * Em empate de distância, ganha a antena de menor (x, y), para que o resultado
+ * não dependa da forma da árvore.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "kdtree.h"
+#include "funcoes.h"
+
+/**
+ * @struct Candidato
+ * @brief Ponto encontrado numa procura, com a distância ao quadrado até à consulta.
+ */
+
+typedef struct Candidato {
+    long long distancia;   /**< Distância euclidiana ao quadrado */
+    PontoKD ponto;         /**< Ponto encontrado */
+} Candidato;
+
+/**
+ * @struct ProcuraKD
+ * @brief Estado de uma procura dos k mais próximos (amontoado de máximo).
+ */
+
+typedef struct ProcuraKD {
+    int x, y;              /**< Posição consultada */
+    Frequencia frequencia; /**< Filtro de frequência */
+    int k;                 /**< Número de pontos pedidos */
+    int n;                 /**< Candidatos no amontoado */
+    Candidato *amontoado;  /**< Melhores candidatos, o pior na raiz */
+} ProcuraKD;
+
+/**
+ * @brief Valor da coordenada de divisão de um ponto.
+ *
+ * @param p Ponto.
+ * @param eixo 0 para X, 1 para Y.
+ * @return Coordenada no eixo indicado.
+ */
+
+static int chaveEixo(const PontoKD *p, int eixo) {
+
+    return eixo ? p -> y : p -> x;
+
+}
+
+/**
+ * @brief Coloca na posição k o elemento que lá ficaria se o intervalo estivesse ordenado.
+ *
+ * No fim, os pontos de [inicio, k) têm chave <= à de k e os de (k, fim) têm chave >=.
+ *
+ * @param p Vetor de pontos.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param k Posição a fixar.
+ * @param eixo Eixo de comparação.
+ */
+
+static void selecionar(PontoKD *p, int inicio, int fim, int k, int eixo) {
+
+    int baixo = inicio, alto = fim - 1;
+
+    while (baixo < alto) {
+
+        int pivo = chaveEixo(&p[baixo + (alto - baixo) / 2], eixo);
+        int i = baixo, j = alto;
+
+        while (i <= j) {
+            while (chaveEixo(&p[i], eixo) < pivo) i++;
+            while (chaveEixo(&p[j], eixo) > pivo) j--;
+            if (i <= j) {
+                PontoKD t = p[i];
+                p[i] = p[j];
+                p[j] = t;
+                i++;
+                j--;
+            }
+        }
+
+        if (k <= j) {
+            alto = j;
+        } else if (k >= i) {
+            baixo = i;
+        } else {
+            break;
+        }
+
+    }
+
+}
+
+/**
+ * @brief Organiza recursivamente o intervalo como subárvore k-d e calcula as máscaras.
+ *
+ * @param a Árvore.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param profundidade Profundidade do nó (define o eixo).
+ */
+
+static void organizarRamo(ArvoreKD *a, int inicio, int fim, int profundidade) {
+
+    if (inicio >= fim) {
+        return;
+    }
+
+    int meio = inicio + (fim - inicio) / 2;
+    selecionar(a -> pontos, inicio, fim, meio, profundidade & 1);
+
+    organizarRamo(a, inicio, meio, profundidade + 1);
+    organizarRamo(a, meio + 1, fim, profundidade + 1);
+
+    uint64_t *m = &a -> mascaras[4 * meio];
+    unsigned char f = (unsigned char)(a -> pontos[meio].frequencia & 255);
+    memset(m, 0, 4 * sizeof(uint64_t));
+    m[f >> 6] |= (uint64_t)1 << (f & 63);
+
+    if (inicio < meio) {
+        const uint64_t *e = &a -> mascaras[4 * (inicio + (meio - inicio) / 2)];
+        for (int w = 0; w < 4; w++) m[w] |= e[w];
+    }
+    if (meio + 1 < fim) {
+        const uint64_t *d = &a -> mascaras[4 * (meio + 1 + (fim - meio - 1) / 2)];
+        for (int w = 0; w < 4; w++) m[w] |= d[w];
+    }
+
+}
+
+/**
+ * @brief Verifica se a subárvore de um nó pode conter a frequência pedida.
+ *
+ * Com mais de 256 frequências a máscara é aproximada (identificadores iguais
+ * módulo 256 partilham o bit), pelo que só pode dar falsos positivos.
+ *
+ * @param a Árvore.
+ * @param no Índice do nó.
+ * @param frequencia Frequência (FREQUENCIA_QUALQUER aceita todas).
+ * @return true se a subárvore deve ser visitada.
+ */
+
+static bool subarvoreTemFrequencia(const ArvoreKD *a, int no, Frequencia frequencia) {
+
+    if (frequencia == FREQUENCIA_QUALQUER) {
+        return true;
+    }
+
+    unsigned char f = (unsigned char)(frequencia & 255);
+
+    return (a -> mascaras[4 * no + (f >> 6)] >> (f & 63)) & 1;
+
+}
+
+/**
+ * @brief Verifica se um ponto está ativo e passa o filtro de frequência.
+ *
+ * @param p Ponto.
+ * @param frequencia Filtro de frequência.
+ * @return true se o ponto conta para a procura.
+ */
+
+static bool pontoAceite(const PontoKD *p, Frequencia frequencia) {
+
+    return !p -> removido && (frequencia == FREQUENCIA_QUALQUER || p -> frequencia == frequencia);
+
+}
+
+/**
+ * @brief Constrói a árvore k-d com todas as antenas da lista.
+ *
+ * @param lista Lista ligada de antenas.
+ * @return Árvore construída, ou false em caso de falha de memória.
+ */
+
+ArvoreKD *construirArvoreKD(Antena *lista) {
+
+    ArvoreKD *a = (ArvoreKD *)calloc(1, sizeof(ArvoreKD));
+    if (!a) {
+        return false;
+    }
+
+    for (Antena *p = lista; p; p = p -> proximo) a -> numPontos++;
+
+    int n = a -> numPontos;
+    a -> pontos = (PontoKD *)malloc((n > 0 ? n : 1) * sizeof(PontoKD));
+    a -> mascaras = (uint64_t *)malloc(4 * (size_t)(n > 0 ? n : 1) * sizeof(uint64_t));
+
+    if (!a -> pontos || !a -> mascaras) {
+        return libertarArvoreKD(a);
+    }
+
+    int i = 0;
+    for (Antena *p = lista; p; p = p -> proximo, i++) {
+        a -> pontos[i].x = p -> x;
+        a -> pontos[i].y = p -> y;
+        a -> pontos[i].frequencia = p -> frequencia;
+        a -> pontos[i].removido = false;
+    }
+
+    organizarRamo(a, 0, n, 0);
+
+    return a;
+
+}
+
+/**
+ * @brief Reconstrói a árvore, retirando os removidos e integrando os pendentes.
+ *
+ * @param a Árvore.
+ * @return true se a reconstrução foi feita, false em caso de falha de memória
+ *         (a árvore anterior mantém-se válida).
+ */
+
+bool reconstruirArvoreKD(ArvoreKD *a) {
+
+    if (!a) {
+        return false;
+    }
+
+    int n = a -> numPontos - a -> numRemovidos + a -> numPendentes;
+    PontoKD *pontos = (PontoKD *)malloc((n > 0 ? n : 1) * sizeof(PontoKD));
+    uint64_t *mascaras = (uint64_t *)malloc(4 * (size_t)(n > 0 ? n : 1) * sizeof(uint64_t));
+
+    if (!pontos || !mascaras) {
+        free(pontos);
+        free(mascaras);
+        return false;
+    }
+
+    int k = 0;
+    for (int i = 0; i < a -> numPontos; i++) {
+        if (!a -> pontos[i].removido) pontos[k++] = a -> pontos[i];
+    }
+    for (int i = 0; i < a -> numPendentes; i++) {
+        pontos[k++] = a -> pendentes[i];
+    }
+
+    free(a -> pontos);
+    free(a -> mascaras);
+    a -> pontos = pontos;
+    a -> mascaras = mascaras;
+    a -> numPontos = n;
+    a -> numRemovidos = 0;
+    a -> numPendentes = 0;
+
+    organizarRamo(a, 0, n, 0);
+
+    return true;
+
+}
+
+/**
+ * @brief Reconstrói a árvore se as alterações acumuladas ultrapassarem o limiar.
+ *
+ * @param a Árvore.
+ */
+
+static void aplicarLimiar(ArvoreKD *a) {
+
+    int alteracoes = a -> numRemovidos + a -> numPendentes;
+
+    if (alteracoes >= MIN_ALTERACOES_KD && alteracoes > LIMIAR_RECONSTRUCAO_KD * a -> numPontos) {
+        reconstruirArvoreKD(a);
+    }
+
+}
+
+/**
+ * @brief Regista a inserção de uma antena (acompanha `inserirAntena`).
+ *
+ * @param a Árvore.
+ * @param frequencia Frequência da antena.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a antena foi registada, false em caso de falha de memória.
+ */
+
+bool inserirPontoKD(ArvoreKD *a, Frequencia frequencia, int x, int y) {
+
+    if (!a) {
+        return false;
+    }
+
+    if (a -> numPendentes == a -> capacidadePendentes) {
+        int capacidade = a -> capacidadePendentes ? 2 * a -> capacidadePendentes : 16;
+        PontoKD *novos = (PontoKD *)realloc(a -> pendentes, capacidade * sizeof(PontoKD));
+        if (!novos) {
+            return false;
+        }
+        a -> pendentes = novos;
+        a -> capacidadePendentes = capacidade;
+    }
+
+    PontoKD p = { x, y, frequencia, false };
+    a -> pendentes[a -> numPendentes++] = p;
+
+    aplicarLimiar(a);
+
+    return true;
+
+}
+
+/**
+ * @brief Procura um ponto ativo com as coordenadas dadas numa subárvore.
+ *
+ * @param a Árvore.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param profundidade Profundidade do nó.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Índice do ponto, ou -1 se não existir.
+ */
+
+static int procurarExato(const ArvoreKD *a, int inicio, int fim, int profundidade, int x, int y) {
+
+    while (inicio < fim) {
+
+        int meio = inicio + (fim - inicio) / 2;
+        const PontoKD *p = &a -> pontos[meio];
+
+        if (p -> x == x && p -> y == y && !p -> removido) {
+            return meio;
+        }
+
+        int eixo = profundidade & 1;
+        int alvo = eixo ? y : x;
+        int chave = chaveEixo(p, eixo);
+
+        if (alvo == chave) {
+            // Valores iguais ao do nó podem estar dos dois lados
+            int i = procurarExato(a, inicio, meio, profundidade + 1, x, y);
+            if (i >= 0) return i;
+            inicio = meio + 1;
+        } else if (alvo < chave) {
+            fim = meio;
+        } else {
+            inicio = meio + 1;
+        }
+        profundidade++;
+
+    }
+
+    return -1;
+
+}
+
+/**
+ * @brief Regista a remoção de uma antena (acompanha `removerAntena`).
+ *
+ * @param a Árvore.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a antena existia na árvore.
+ */
+
+bool removerPontoKD(ArvoreKD *a, int x, int y) {
+
+    if (!a) {
+        return false;
+    }
+
+    for (int i = 0; i < a -> numPendentes; i++) {
+        if (a -> pendentes[i].x == x && a -> pendentes[i].y == y) {
+            a -> pendentes[i] = a -> pendentes[--a -> numPendentes];
+            return true;
+        }
+    }
+
+    int i = procurarExato(a, 0, a -> numPontos, 0, x, y);
+    if (i < 0) {
+        return false;
+    }
+
+    a -> pontos[i].removido = true;
+    a -> numRemovidos++;
+
+    aplicarLimiar(a);
+
+    return true;
+
+}
+
+/**
+ * @brief Distância euclidiana ao quadrado entre um ponto e a posição consultada.
+ *
+ * @param p Ponto.
+ * @param x Coordenada X consultada.
+ * @param y Coordenada Y consultada.
+ * @return Distância ao quadrado.
+ */
+
+static long long distanciaQuadrado(const PontoKD *p, int x, int y) {
+
+    long long dx = (long long)p -> x - x;
+    long long dy = (long long)p -> y - y;
+
+    return dx * dx + dy * dy;
+
+}
+
+/**
+ * @brief Ordem total dos candidatos: distância, depois X, depois Y.
+ *
+ * @param a Primeiro candidato.
+ * @param b Segundo candidato.
+ * @return true se `a` é pior (vem depois) do que `b`.
+ */
+
+static bool pior(const Candidato *a, const Candidato *b) {
+
+    if (a -> distancia != b -> distancia) return a -> distancia > b -> distancia;
+    if (a -> ponto.x != b -> ponto.x) return a -> ponto.x > b -> ponto.x;
+
+    return a -> ponto.y > b -> ponto.y;
+
+}
+
+/**
+ * @brief Repõe a propriedade de amontoado a partir da raiz.
+ *
+ * @param h Amontoado.
+ * @param n Número de elementos.
+ */
+
+static void descerAmontoado(Candidato *h, int n) {
+
+    int i = 0;
+    while (true) {
+        int e = 2 * i + 1, d = e + 1, m = i;
+        if (e < n && pior(&h[e], &h[m])) m = e;
+        if (d < n && pior(&h[d], &h[m])) m = d;
+        if (m == i) break;
+        Candidato t = h[i];
+        h[i] = h[m];
+        h[m] = t;
+        i = m;
+    }
+
+}
+
+/**
+ * @brief Considera um ponto para os k melhores.
+ *
+ * @param s Estado da procura.
+ * @param p Ponto.
+ */
+
+static void considerar(ProcuraKD *s, const PontoKD *p) {
+
+    Candidato c = { distanciaQuadrado(p, s -> x, s -> y), *p };
+
+    if (s -> n < s -> k) {
+        // Sobe o novo candidato até à sua posição
+        int i = s -> n++;
+        while (i > 0 && pior(&c, &s -> amontoado[(i - 1) / 2])) {
+            s -> amontoado[i] = s -> amontoado[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        s -> amontoado[i] = c;
+    } else if (pior(&s -> amontoado[0], &c)) {
+        s -> amontoado[0] = c;
+        descerAmontoado(s -> amontoado, s -> n);
+    }
+
+}
+
+/**
+ * @brief Procura os k mais próximos numa subárvore.
+ *
+ * @param a Árvore.
+ * @param s Estado da procura.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param profundidade Profundidade do nó.
+ */
+
+static void procurarVizinhas(const ArvoreKD *a, ProcuraKD *s, int inicio, int fim, int profundidade) {
+
+    if (inicio >= fim) {
+        return;
+    }
+
+    int meio = inicio + (fim - inicio) / 2;
+    if (!subarvoreTemFrequencia(a, meio, s -> frequencia)) {
+        return;
+    }
+
+    const PontoKD *p = &a -> pontos[meio];
+    if (pontoAceite(p, s -> frequencia)) {
+        considerar(s, p);
+    }
+
+    int eixo = profundidade & 1;
+    long long diferenca = (long long)(eixo ? s -> y : s -> x) - chaveEixo(p, eixo);
+
+    if (diferenca < 0) {
+        procurarVizinhas(a, s, inicio, meio, profundidade + 1);
+        if (s -> n < s -> k || diferenca * diferenca <= s -> amontoado[0].distancia) {
+            procurarVizinhas(a, s, meio + 1, fim, profundidade + 1);
+        }
+    } else {
+        procurarVizinhas(a, s, meio + 1, fim, profundidade + 1);
+        if (s -> n < s -> k || diferenca * diferenca <= s -> amontoado[0].distancia) {
+            procurarVizinhas(a, s, inicio, meio, profundidade + 1);
+        }
+    }
+
+}
+
+/**
+ * @brief Obtém as k antenas mais próximas de uma posição.
+ *
+ * @param a Árvore.
+ * @param x Coordenada X consultada.
+ * @param y Coordenada Y consultada.
+ * @param frequencia Frequência pretendida (FREQUENCIA_QUALQUER para todas).
+ * @param k Número de antenas pedidas.
+ * @param resultado Vetor com espaço para k pontos, preenchido por distância crescente.
+ * @return Número de antenas encontradas (até k), ou -1 em caso de falha de memória.
+ */
+
+int vizinhasKD(const ArvoreKD *a, int x, int y, Frequencia frequencia, int k, PontoKD *resultado) {
+
+    if (!a || k <= 0) {
+        return 0;
+    }
+
+    ProcuraKD s = { x, y, frequencia, k, 0, (Candidato *)malloc(k * sizeof(Candidato)) };
+    if (!s.amontoado) {
+        return -1;
+    }
+
+    procurarVizinhas(a, &s, 0, a -> numPontos, 0);
+    for (int i = 0; i < a -> numPendentes; i++) {
+        if (pontoAceite(&a -> pendentes[i], frequencia)) considerar(&s, &a -> pendentes[i]);
+    }
+
+    // Esvazia o amontoado do pior para o melhor
+    int n = s.n;
+    for (int i = n - 1; i >= 0; i--) {
+        resultado[i] = s.amontoado[0].ponto;
+        s.amontoado[0] = s.amontoado[--s.n];
+        descerAmontoado(s.amontoado, s.n);
+    }
+
+    free(s.amontoado);
+
+    return n;
+
+}
+
+/**
+ * @brief Obtém a antena mais próxima de uma posição.
+ *
+ * @param a Árvore.
+ * @param x Coordenada X consultada.
+ * @param y Coordenada Y consultada.
+ * @param frequencia Frequência pretendida (FREQUENCIA_QUALQUER para todas).
+ * @param resultado Antena encontrada.
+ * @return true se existe alguma antena que passe o filtro.
+ */
+
+bool maisProximaKD(const ArvoreKD *a, int x, int y, Frequencia frequencia, PontoKD *resultado) {
+
+    return vizinhasKD(a, x, y, frequencia, 1, resultado) == 1;
+
+}
+
+/**
+ * @brief Acrescenta à lista os pontos de uma subárvore dentro do raio.
+ *
+ * @param a Árvore.
+ * @param inicio Início do intervalo.
+ * @param fim Fim (exclusivo) do intervalo.
+ * @param profundidade Profundidade do nó.
+ * @param x Coordenada X consultada.
+ * @param y Coordenada Y consultada.
+ * @param raioQuadrado Raio ao quadrado.
+ * @param frequencia Filtro de frequência.
+ * @param lista Lista onde acrescentar.
+ * @param semMemoria Posto a true (e a procura interrompida) se uma alocação falhar.
+ * @return Nova cabeça da lista.
+ */
+
+static Coordenada *procurarRaio(const ArvoreKD *a, int inicio, int fim, int profundidade, int x, int y,
+                                double raioQuadrado, Frequencia frequencia, Coordenada *lista, bool *semMemoria) {
+
+    while (inicio < fim && !*semMemoria) {
+
+        int meio = inicio + (fim - inicio) / 2;
+        if (!subarvoreTemFrequencia(a, meio, frequencia)) {
+            break;
+        }
+
+        const PontoKD *p = &a -> pontos[meio];
+        if (pontoAceite(p, frequencia) && distanciaQuadrado(p, x, y) <= raioQuadrado) {
+            Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+            if (!nova) {
+                *semMemoria = true;
+                break;
+            }
+            nova -> x = p -> x;
+            nova -> y = p -> y;
+            nova -> proximo = lista;
+            lista = nova;
+        }
+
+        int eixo = profundidade & 1;
+        double diferenca = (double)(eixo ? y : x) - chaveEixo(p, eixo);
+
+        // Visita recursivamente o lado que o círculo também toca e continua pelo outro
+        if (diferenca < 0) {
+            if (diferenca * diferenca <= raioQuadrado) {
+                lista = procurarRaio(a, meio + 1, fim, profundidade + 1, x, y, raioQuadrado, frequencia, lista, semMemoria);
+            }
+            fim = meio;
+        } else {
+            if (diferenca * diferenca <= raioQuadrado) {
+                lista = procurarRaio(a, inicio, meio, profundidade + 1, x, y, raioQuadrado, frequencia, lista, semMemoria);
+            }
+            inicio = meio + 1;
+        }
+        profundidade++;
+
+    }
+
+    return lista;
+
+}
+
+/**
+ * @brief Obtém as antenas a distância <= raio de uma posição.
+ *
+ * @param a Árvore.
+ * @param x Coordenada X consultada.
+ * @param y Coordenada Y consultada.
+ * @param raio Raio da procura.
+ * @param frequencia Frequência pretendida (FREQUENCIA_QUALQUER para todas).
+ * @return Lista (sem ordem definida) das posições encontradas, ou NULL se não houver nenhuma
+ *         ou faltar memória.
+ */
+
+Coordenada *raioKD(const ArvoreKD *a, int x, int y, double raio, Frequencia frequencia) {
+
+    if (!a || raio < 0) {
+        return NULL;
+    }
+
+    bool semMemoria = false;
+    double raioQuadrado = raio * raio;
+    Coordenada *lista = procurarRaio(a, 0, a -> numPontos, 0, x, y, raioQuadrado, frequencia, NULL, &semMemoria);
+
+    for (int i = 0; i < a -> numPendentes && !semMemoria; i++) {
+        const PontoKD *p = &a -> pendentes[i];
+        if (pontoAceite(p, frequencia) && distanciaQuadrado(p, x, y) <= raioQuadrado) {
+            Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+            if (!nova) {
+                semMemoria = true;
+                break;
+            }
+            nova -> x = p -> x;
+            nova -> y = p -> y;
+            nova -> proximo = lista;
+            lista = nova;
+        }
+    }
+
+    if (semMemoria) {
+        return libertarCoordenadas(lista);
+    }
+
+    return lista;
+
+}
+
+/**
+ * @brief Liberta a árvore.
+ *
+ * @param a Árvore.
+ * @return false após a libertação.
+ */
+
+ArvoreKD *libertarArvoreKD(ArvoreKD *a) {
+
+    if (!a) {
+        return false;
+    }
+
+    free(a -> pontos);
+    free(a -> mascaras);
+    free(a -> pendentes);
+    free(a);
+
+    return false;
+
+}
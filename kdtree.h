@@ -0,0 +1,76 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file kdtree.h
+ * @author Thiago Abreu
+ * @brief Árvore k-d das antenas para procuras por proximidade.
+ *
+ * Responde a "antena mais próxima", "k antenas mais próximas" e "antenas dentro
+ * de um raio", opcionalmente restritas a uma frequência, sem percorrer a lista
+ * inteira. Cada nó guarda a máscara das frequências da sua subárvore, pelo que o
+ * filtro por frequência também corta ramos inteiros.
+ *
+ * As inserções e remoções posteriores à construção ficam numa zona pendente
+ * (inserções) ou marcadas no próprio nó (remoções); quando as alterações
+ * ultrapassam uma fração da árvore, esta é reconstruída de raiz.
+ */
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "antenas.h"
+
+/** Fração de alterações (sobre o tamanho da árvore) que provoca a reconstrução. */
+#define LIMIAR_RECONSTRUCAO_KD 0.25
+
+/** Número mínimo de alterações antes de se considerar a reconstrução. */
+#define MIN_ALTERACOES_KD 32
+
+/**
+ * @struct PontoKD
+ * @brief Antena guardada na árvore.
+ */
+
+typedef struct PontoKD {
+    int x, y;              /**< Coordenadas da antena */
+    Frequencia frequencia; /**< Frequência da antena */
+    bool removido;         /**< true se a antena foi removida desde a última construção */
+} PontoKD;
+
+/**
+ * @struct ArvoreKD
+ * @brief Árvore k-d implícita num vetor, com zona de inserções pendentes.
+ *
+ * O nó do intervalo [inicio, fim) é `pontos[(inicio + fim) / 2]`; a subárvore
+ * esquerda é [inicio, meio) e a direita [meio + 1, fim). A profundidade par divide
+ * por X e a ímpar por Y.
+ */
+
+typedef struct ArvoreKD {
+    int numPontos;          /**< Pontos na árvore (incluindo removidos) */
+    int numRemovidos;       /**< Pontos marcados como removidos */
+    PontoKD *pontos;        /**< Nós da árvore */
+    uint64_t *mascaras;     /**< 4 palavras por nó: frequências presentes na subárvore (identificador módulo 256) */
+    int numPendentes;       /**< Inserções ainda fora da árvore */
+    int capacidadePendentes;/**< Capacidade do vetor de pendentes */
+    PontoKD *pendentes;     /**< Inserções ainda fora da árvore */
+} ArvoreKD;
+
+ArvoreKD *construirArvoreKD(Antena *lista);
+bool reconstruirArvoreKD(ArvoreKD *a);
+bool inserirPontoKD(ArvoreKD *a, Frequencia frequencia, int x, int y);
+bool removerPontoKD(ArvoreKD *a, int x, int y);
+bool maisProximaKD(const ArvoreKD *a, int x, int y, Frequencia frequencia, PontoKD *resultado);
+int vizinhasKD(const ArvoreKD *a, int x, int y, Frequencia frequencia, int k, PontoKD *resultado);
+Coordenada *raioKD(const ArvoreKD *a, int x, int y, double raio, Frequencia frequencia);
+ArvoreKD *libertarArvoreKD(ArvoreKD *a);
+
+#endif
@@ -0,0 +1,611 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file ligacoes.c
+ * @author Thiago Abreu
+ * @brief Implementação dos construtores de ligações geométricas.
+ *
+ * As células da grelha sobre o segmento entre (x1, y1) e (x2, y2) são as
+ * (x1 + k * dx / g, y1 + k * dy / g), com g = mdc(|dx|, |dy|) e 0 < k < g. Cada
+ * uma é testada no índice de coordenadas em tempo constante, pelo que um par
+ * custa O(g) em vez de O(n) e os pares com g = 1 são visíveis sem nenhum teste.
+ *
+ * Para o alcance R, cada vértice cai numa célula de lado ceil(R); um par a
+ * distância <= R fica sempre na mesma célula ou em células vizinhas, pelo que só
+ * essas são comparadas.
+ *
+ * A inserção em lote resolve as células pelo índice de coordenadas, orienta cada
+ * par pela ordem (x, y) das antenas e ordena-os, pelo que os repetidos ficam
+ * adjacentes; os já existentes no grafo são procurados na adjacência ordenada
+ * de cada origem.
+ *
+ * Nos construtores geométricos, os vizinhos de cada origem são marcados num vetor
+ * indexado pela entrada do vértice no índice de coordenadas, pelo que testar se um
+ * par já está ligado custa O(1) e não O(grau).
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include "ligacoes.h"
+#include "indice.h"
+
+/**
+ * @brief Máximo divisor comum de dois valores não negativos.
+ *
+ * @param a Primeiro valor.
+ * @param b Segundo valor.
+ * @return mdc(a, b).
+ */
+
+static int mdc(int a, int b) {
+
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+
+}
+
+/**
+ * @struct EntradaCelula
+ * @brief Vértice com a célula da grelha espacial a que pertence.
+ */
+
+typedef struct EntradaCelula {
+    Vertice *v;          /**< Vértice */
+    int cx, cy;          /**< Célula da grelha */
+} EntradaCelula;
+
+/**
+ * @struct Celula
+ * @brief Entrada da tabela de dispersão: intervalo de vértices de uma célula e frequência.
+ */
+
+typedef struct Celula {
+    int inicio, fim;     /**< Intervalo [inicio, fim) no vetor ordenado (fim = 0 se livre) */
+} Celula;
+
+/**
+ * @brief Ordena as entradas por frequência e depois pela célula.
+ *
+ * @param a Primeira entrada.
+ * @param b Segunda entrada.
+ * @return Valor negativo, zero ou positivo, como em `qsort`.
+ */
+
+static int compararEntradas(const void *a, const void *b) {
+
+    const EntradaCelula *e1 = (const EntradaCelula *)a;
+    const EntradaCelula *e2 = (const EntradaCelula *)b;
+
+    if (e1 -> v -> frequencia != e2 -> v -> frequencia) {
+        return e1 -> v -> frequencia < e2 -> v -> frequencia ? -1 : 1;
+    }
+    if (e1 -> cx != e2 -> cx) return e1 -> cx < e2 -> cx ? -1 : 1;
+    if (e1 -> cy != e2 -> cy) return e1 -> cy < e2 -> cy ? -1 : 1;
+
+    return 0;
+
+}
+
+/**
+ * @brief Posição inicial de uma célula (com frequência) na tabela de dispersão.
+ *
+ * @param frequencia Frequência.
+ * @param cx Coluna da célula.
+ * @param cy Linha da célula.
+ * @param capacidade Tamanho da tabela (potência de 2).
+ * @return Posição na tabela.
+ */
+
+static int dispersaoCelula(Frequencia frequencia, int cx, int cy, int capacidade) {
+
+    uint64_t h = ((uint64_t)(uint32_t)cx << 32 | (uint32_t)cy) * 0x9E3779B97F4A7C15ULL;
+    h ^= (uint64_t)frequencia * 0xBF58476D1CE4E5B9ULL;
+
+    return (int)((h >> 32) & (uint64_t)(capacidade - 1));
+
+}
+
+/**
+ * @brief Procura o intervalo de vértices de uma célula com dada frequência.
+ *
+ * @param tabela Tabela de dispersão das células.
+ * @param capacidade Tamanho da tabela.
+ * @param entradas Vetor ordenado de entradas.
+ * @param frequencia Frequência.
+ * @param cx Coluna da célula.
+ * @param cy Linha da célula.
+ * @return Apontador para a célula, ou NULL se estiver vazia.
+ */
+
+static const Celula *procurarCelula(const Celula *tabela, int capacidade, const EntradaCelula *entradas,
+                                    Frequencia frequencia, int cx, int cy) {
+
+    int p = dispersaoCelula(frequencia, cx, cy, capacidade);
+
+    while (tabela[p].fim) {
+        const EntradaCelula *e = &entradas[tabela[p].inicio];
+        if (e -> v -> frequencia == frequencia && e -> cx == cx && e -> cy == cy) {
+            return &tabela[p];
+        }
+        p = (p + 1) & (capacidade - 1);
+    }
+
+    return NULL;
+
+}
+
+/**
+ * @brief Divisão inteira arredondada para baixo (também para valores negativos).
+ *
+ * @param a Dividendo.
+ * @param b Divisor positivo.
+ * @return floor(a / b).
+ */
+
+static int divisaoInferior(int a, int b) {
+
+    return a >= 0 ? a / b : -((-(long long)a + b - 1) / b);
+
+}
+
+/**
+ * @struct ParResolvido
+ * @brief Par de vértices de um pedido de ligação, com a origem antes do destino em (x, y).
+ */
+
+typedef struct ParResolvido {
+    Vertice *origem;     /**< Vértice de menor (x, y) */
+    Vertice *destino;    /**< Vértice de maior (x, y) */
+} ParResolvido;
+
+/**
+ * @brief Compara dois vértices pela ordem (x, y).
+ *
+ * @param a Primeiro vértice.
+ * @param b Segundo vértice.
+ * @return Valor negativo, zero ou positivo.
+ */
+
+static int compararPosicao(const Vertice *a, const Vertice *b) {
+
+    if (a -> x != b -> x) return a -> x < b -> x ? -1 : 1;
+    if (a -> y != b -> y) return a -> y < b -> y ? -1 : 1;
+
+    return 0;
+
+}
+
+/**
+ * @brief Ordena os pares resolvidos por origem e depois por destino.
+ *
+ * @param a Primeiro par.
+ * @param b Segundo par.
+ * @return Valor negativo, zero ou positivo, como em `qsort`.
+ */
+
+static int compararPares(const void *a, const void *b) {
+
+    const ParResolvido *p1 = (const ParResolvido *)a;
+    const ParResolvido *p2 = (const ParResolvido *)b;
+
+    int c = compararPosicao(p1 -> origem, p2 -> origem);
+
+    return c ? c : compararPosicao(p1 -> destino, p2 -> destino);
+
+}
+
+/**
+ * @brief Ordena apontadores de vértices pela ordem (x, y).
+ *
+ * @param a Primeiro apontador.
+ * @param b Segundo apontador.
+ * @return Valor negativo, zero ou positivo, como em `qsort`.
+ */
+
+static int compararVertices(const void *a, const void *b) {
+
+    return compararPosicao(*(Vertice *const *)a, *(Vertice *const *)b);
+
+}
+
+/**
+ * @brief Marca os vizinhos atuais de um vértice, pela entrada de cada um no índice.
+ *
+ * Depois disto, `ligado` testa se um par já tem aresta em O(1), em vez de
+ * percorrer a adjacência de v1 para cada candidato.
+ *
+ * @param ind Índice de coordenadas do grafo.
+ * @param marcas Vetor com `ind -> capacidade` posições.
+ * @param v1 Vértice cujos vizinhos são marcados.
+ * @param marca Valor que identifica v1 (nunca 0).
+ */
+
+static void marcarVizinhos(const IndiceCoordenadas *ind, int *marcas, const Vertice *v1, int marca) {
+
+    for (Aresta *a = v1 -> arestas; a; a = a -> proximo) {
+        int p = entradaIndice(ind, a -> destino -> x, a -> destino -> y);
+        if (p >= 0) marcas[p] = marca;
+    }
+
+}
+
+/**
+ * @brief Verifica se v2 foi marcado como vizinho do vértice com a marca dada.
+ *
+ * @param ind Índice de coordenadas do grafo.
+ * @param marcas Vetor preenchido por `marcarVizinhos`.
+ * @param v2 Vértice de destino.
+ * @param marca Valor que identifica a origem.
+ * @return true se os vértices já estão ligados.
+ */
+
+static bool ligado(const IndiceCoordenadas *ind, const int *marcas, const Vertice *v2, int marca) {
+
+    int p = entradaIndice(ind, v2 -> x, v2 -> y);
+
+    return p >= 0 && marcas[p] == marca;
+
+}
+
+/**
+ * @brief Verifica se alguma antena ocupa uma célula entre dois vértices.
+ *
+ * @param ind Índice de coordenadas do grafo.
+ * @param v1 Primeiro vértice.
+ * @param v2 Segundo vértice.
+ * @return true se o segmento entre os dois está livre.
+ */
+
+static bool emLinhaDeVista(const IndiceCoordenadas *ind, const Vertice *v1, const Vertice *v2) {
+
+    int dx = v2 -> x - v1 -> x;
+    int dy = v2 -> y - v1 -> y;
+    int g = mdc(dx < 0 ? -dx : dx, dy < 0 ? -dy : dy);
+
+    if (g == 0) {
+        return false; // Mesma célula
+    }
+
+    int sx = dx / g, sy = dy / g;
+    for (int k = 1; k < g; k++) {
+        if (verticeEm(ind, v1 -> x + k * sx, v1 -> y + k * sy)) {
+            return false;
+        }
+    }
+
+    return true;
+
+}
+
+/**
+ * @brief Insere um lote de ligações, rejeitando pares inválidos e duplicados.
+ *
+ * Cada par é resolvido pelo índice em O(1), orientado e ordenado; depois, para
+ * cada origem, a adjacência existente é ordenada uma vez e cada destino é
+ * procurado nela por pesquisa binária. Os pares aceites são ligados com
+ * `ligarVertices`.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param ind Índice de coordenadas do grafo (NULL para construir um temporário).
+ * @param pares Pedidos de ligação.
+ * @param numPares Número de pedidos.
+ * @param resumo Contagens de ligações criadas e rejeitadas (pode ser NULL).
+ * @return true se o lote foi processado, false em caso de falha de memória.
+ */
+
+bool ligarEmLote(Vertice *grafo, IndiceCoordenadas *ind, const ParLigacao *pares, long numPares, ResumoLigacoes *resumo) {
+
+    ResumoLigacoes r = { 0, 0, 0, 0 };
+    if (resumo) *resumo = r;
+
+    if (numPares <= 0) {
+        return true;
+    }
+
+    IndiceCoordenadas *temporario = ind ? NULL : construirIndiceCoordenadas(grafo);
+    if (!ind) ind = temporario;
+
+    ParResolvido *resolvidos = (ParResolvido *)malloc(numPares * sizeof(ParResolvido));
+
+    if (!ind || !resolvidos) {
+        libertarIndiceCoordenadas(temporario);
+        free(resolvidos);
+        return false;
+    }
+
+    long n = 0;
+    for (long i = 0; i < numPares; i++) {
+
+        Vertice *v1 = verticeEm(ind, pares[i].x1, pares[i].y1);
+        Vertice *v2 = verticeEm(ind, pares[i].x2, pares[i].y2);
+
+        if (!v1 || !v2 || v1 == v2) {
+            r.semVertice++;
+        } else if (v1 -> frequencia != v2 -> frequencia) {
+            r.frequenciaDiferente++;
+        } else {
+            bool trocar = compararPosicao(v1, v2) > 0;
+            resolvidos[n].origem = trocar ? v2 : v1;
+            resolvidos[n].destino = trocar ? v1 : v2;
+            n++;
+        }
+
+    }
+
+    qsort(resolvidos, n, sizeof(ParResolvido), compararPares);
+
+    bool sucesso = true;
+    Vertice **vizinhos = NULL;
+    long capacidadeVizinhos = 0;
+
+    for (long inicio = 0; inicio < n && sucesso; ) {
+
+        Vertice *origem = resolvidos[inicio].origem;
+        long fim = inicio;
+        while (fim < n && resolvidos[fim].origem == origem) fim++;
+
+        // Vizinhos atuais da origem, ordenados, antes de acrescentar o grupo
+        long grau = 0;
+        for (Aresta *a = origem -> arestas; a; a = a -> proximo) grau++;
+        if (grau > capacidadeVizinhos) {
+            Vertice **novos = (Vertice **)realloc(vizinhos, grau * sizeof(Vertice *));
+            if (!novos) {
+                sucesso = false;
+                break;
+            }
+            vizinhos = novos;
+            capacidadeVizinhos = grau;
+        }
+        long k = 0;
+        for (Aresta *a = origem -> arestas; a; a = a -> proximo) vizinhos[k++] = a -> destino;
+        if (grau > 1) qsort(vizinhos, grau, sizeof(Vertice *), compararVertices);
+
+        for (long i = inicio; i < fim; i++) {
+
+            Vertice *destino = resolvidos[i].destino;
+
+            if ((i > inicio && resolvidos[i - 1].destino == destino) ||
+                (grau > 0 && bsearch(&destino, vizinhos, grau, sizeof(Vertice *), compararVertices))) {
+                r.duplicadas++;
+                continue;
+            }
+
+            if (!ligarVertices(origem, destino)) {
+                sucesso = false;
+                break;
+            }
+            r.criadas++;
+
+        }
+
+        inicio = fim;
+
+    }
+
+    free(vizinhos);
+    free(resolvidos);
+    libertarIndiceCoordenadas(temporario);
+
+    if (resumo) *resumo = r;
+
+    return sucesso;
+
+}
+
+/**
+ * @brief Liga todos os pares de antenas da mesma frequência em linha de vista.
+ *
+ * Os vértices são agrupados por frequência (ordenação por contagem) e, dentro de
+ * cada grupo, cada par é ligado se nenhuma antena, de qualquer frequência, estiver
+ * numa célula do segmento entre os dois. Os pares já ligados são mantidos sem
+ * duplicar arestas, pelo que a função pode ser chamada de novo após alterações.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @return Número de ligações criadas, ou -1 em caso de falha de memória.
+ */
+
+long ligarVisiveis(Vertice *grafo) {
+
+    int n = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) n++;
+
+    if (n < 2) {
+        return 0;
+    }
+
+    int nf = numFrequencias();
+    int *contagem = (int *)calloc(nf + 1, sizeof(int));
+    int *posicao = (int *)malloc((nf > 0 ? nf : 1) * sizeof(int));
+    IndiceCoordenadas *ind = construirIndiceCoordenadas(grafo);
+    Vertice **grupos = (Vertice **)malloc(n * sizeof(Vertice *));
+    int *marcas = ind ? (int *)calloc(ind -> capacidade, sizeof(int)) : NULL;
+
+    if (!contagem || !posicao || !ind || !grupos || !marcas) {
+        free(contagem);
+        free(posicao);
+        libertarIndiceCoordenadas(ind);
+        free(grupos);
+        free(marcas);
+        return -1;
+    }
+
+    for (Vertice *v = grafo; v; v = v -> proximo) contagem[v -> frequencia + 1]++;
+    for (int f = 0; f < nf; f++) contagem[f + 1] += contagem[f];
+    for (int f = 0; f < nf; f++) posicao[f] = contagem[f];
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        grupos[posicao[v -> frequencia]++] = v;
+    }
+
+    long criadas = 0;
+    for (int f = 0; f < nf && criadas >= 0; f++) {
+        for (int i = contagem[f]; i < contagem[f + 1] && criadas >= 0; i++) {
+
+            // As arestas criadas neste ciclo vão para vértices ainda não vistos por v1
+            marcarVizinhos(ind, marcas, grupos[i], i + 1);
+
+            for (int j = i + 1; j < contagem[f + 1]; j++) {
+
+                Vertice *v1 = grupos[i], *v2 = grupos[j];
+
+                if (!emLinhaDeVista(ind, v1, v2) || ligado(ind, marcas, v2, i + 1)) {
+                    continue;
+                }
+
+                if (!ligarVertices(v1, v2)) {
+                    criadas = -1;
+                    break;
+                }
+                criadas++;
+
+            }
+        }
+    }
+
+    free(contagem);
+    free(posicao);
+    free(grupos);
+    free(marcas);
+    libertarIndiceCoordenadas(ind);
+
+    return criadas;
+
+}
+
+/**
+ * @brief Liga todos os pares de antenas da mesma frequência a distância <= raio.
+ *
+ * Os vértices são distribuídos por células de lado ceil(raio) e ordenados por
+ * (frequência, célula), ficando cada célula num intervalo contíguo que a tabela
+ * de dispersão localiza em tempo constante. Cada vértice é comparado com os
+ * seguintes da sua célula e com as quatro células vizinhas "à frente" (as outras
+ * quatro tratam o par pelo lado oposto), pelo que cada par é visto uma só vez.
+ * Os pares já ligados são mantidos sem duplicar arestas.
+ *
+ * @param grafo Apontador para o início da lista de vértices.
+ * @param raio Alcance de transmissão (distância euclidiana).
+ * @return Número de ligações criadas, ou -1 em caso de falha de memória.
+ */
+
+long ligarRaio(Vertice *grafo, double raio) {
+
+    if (!(raio > 0)) {
+        return 0;
+    }
+
+    int n = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) n++;
+
+    if (n < 2) {
+        return 0;
+    }
+
+    int lado = raio >= INT_MAX ? INT_MAX : (int)raio + ((double)(int)raio < raio);
+    double raioQuadrado = raio * raio;
+
+    int capacidade = 16;
+    while (capacidade < 2 * n) capacidade *= 2;
+
+    EntradaCelula *entradas = (EntradaCelula *)malloc(n * sizeof(EntradaCelula));
+    Celula *tabela = (Celula *)calloc(capacidade, sizeof(Celula));
+    IndiceCoordenadas *ind = construirIndiceCoordenadas(grafo);
+    int *marcas = ind ? (int *)calloc(ind -> capacidade, sizeof(int)) : NULL;
+
+    if (!entradas || !tabela || !ind || !marcas) {
+        free(entradas);
+        free(tabela);
+        libertarIndiceCoordenadas(ind);
+        free(marcas);
+        return -1;
+    }
+
+    int i = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo, i++) {
+        entradas[i].v = v;
+        entradas[i].cx = divisaoInferior(v -> x, lado);
+        entradas[i].cy = divisaoInferior(v -> y, lado);
+    }
+
+    qsort(entradas, n, sizeof(EntradaCelula), compararEntradas);
+
+    // Uma entrada da tabela por célula não vazia
+    for (int inicio = 0; inicio < n; ) {
+
+        int fim = inicio + 1;
+        while (fim < n && compararEntradas(&entradas[inicio], &entradas[fim]) == 0) fim++;
+
+        int p = dispersaoCelula(entradas[inicio].v -> frequencia, entradas[inicio].cx, entradas[inicio].cy, capacidade);
+        while (tabela[p].fim) p = (p + 1) & (capacidade - 1);
+        tabela[p].inicio = inicio;
+        tabela[p].fim = fim;
+
+        inicio = fim;
+
+    }
+
+    static const int vizinhas[4][2] = { { 0, 1 }, { 1, -1 }, { 1, 0 }, { 1, 1 } };
+
+    long criadas = 0;
+    for (i = 0; i < n && criadas >= 0; i++) {
+
+        Vertice *v1 = entradas[i].v;
+        marcarVizinhos(ind, marcas, v1, i + 1);
+
+        for (int k = -1; k < 4 && criadas >= 0; k++) {
+
+            int inicio, fim;
+            if (k < 0) {
+                // Restantes vértices da própria célula
+                inicio = i + 1;
+                fim = i + 1;
+                while (fim < n && compararEntradas(&entradas[i], &entradas[fim]) == 0) fim++;
+            } else {
+                long long cx = (long long)entradas[i].cx + vizinhas[k][0];
+                long long cy = (long long)entradas[i].cy + vizinhas[k][1];
+                if (cx > INT_MAX || cy > INT_MAX || cy < INT_MIN) continue;
+                const Celula *c = procurarCelula(tabela, capacidade, entradas, v1 -> frequencia, (int)cx, (int)cy);
+                if (!c) continue;
+                inicio = c -> inicio;
+                fim = c -> fim;
+            }
+
+            for (int j = inicio; j < fim; j++) {
+
+                Vertice *v2 = entradas[j].v;
+                double dx = (double)v2 -> x - v1 -> x;
+                double dy = (double)v2 -> y - v1 -> y;
+
+                if (dx * dx + dy * dy > raioQuadrado || ligado(ind, marcas, v2, i + 1)) {
+                    continue;
+                }
+
+                if (!ligarVertices(v1, v2)) {
+                    criadas = -1;
+                    break;
+                }
+                criadas++;
+
+            }
+
+        }
+
+    }
+
+    free(entradas);
+    free(tabela);
+    free(marcas);
+    libertarIndiceCoordenadas(ind);
+
+    return criadas;
+
+}
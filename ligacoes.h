@@ -0,0 +1,54 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file ligacoes.h
+ * @author Thiago Abreu
+ * @brief Construção automática de ligações a partir da geometria do mapa.
+ *
+ * Em vez de ligar cada par de antenas da mesma frequência (um grafo completo por
+ * frequência), liga apenas os pares em linha de vista: nenhuma outra antena ocupa
+ * uma célula do segmento da grelha entre as duas. Em alternativa, liga os pares
+ * dentro de um alcance de transmissão, com os vértices distribuídos por uma grelha
+ * de dispersão espacial. Para ligações escolhidas pelo utilizador, há uma inserção
+ * em lote que rejeita pares inválidos e duplicados.
+ */
+
+#ifndef LIGACOES_H
+#define LIGACOES_H
+
+#include "grafo.h"
+#include "indice.h"
+
+/**
+ * @struct ParLigacao
+ * @brief Pedido de ligação entre as antenas de duas células.
+ */
+
+typedef struct ParLigacao {
+    int x1, y1;            /**< Primeira antena */
+    int x2, y2;            /**< Segunda antena */
+} ParLigacao;
+
+/**
+ * @struct ResumoLigacoes
+ * @brief Resultado de uma inserção de ligações em lote.
+ */
+
+typedef struct ResumoLigacoes {
+    long criadas;               /**< Ligações novas */
+    long semVertice;            /**< Pares com uma célula sem antena, ou com as duas na mesma célula */
+    long frequenciaDiferente;   /**< Pares de antenas com frequências diferentes */
+    long duplicadas;            /**< Pares repetidos no lote ou já ligados no grafo */
+} ResumoLigacoes;
+
+bool ligarEmLote(Vertice *grafo, IndiceCoordenadas *ind, const ParLigacao *pares, long numPares, ResumoLigacoes *resumo);
+long ligarVisiveis(Vertice *grafo);
+long ligarRaio(Vertice *grafo, double raio);
+
+#endif
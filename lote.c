@@ -0,0 +1,479 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file lote.c
+ * @author Thiago Abreu
+ * @brief Implementação da execução de consultas em lote.
+ *
+ * O trabalho comum é feito uma só vez para todo o ficheiro:
+ *  - as componentes ligadas são calculadas numa travessia e respondem a todas
+ *    as consultas de alcance (e descartam caminhos impossíveis) em O(1);
+ *  - as consultas de caminho são ordenadas por origem e cada origem distinta entra
+ *    numa travessia em lote (`procuraLarguraMultipla`), da qual se reconstroem os
+ *    caminhos mais curtos de todas as consultas dessa origem;
+ *  - as antenas são agrupadas por frequência uma única vez para as interseções.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lote.h"
+#include "procuras.h"
+#include "tempo.h"
+
+/** Tamanho do tampão de escrita do ficheiro de resultados. */
+#define TAMPAO_RESULTADOS (1 << 20)
+
+/** Máximo de entradas da tabela de distâncias de cada travessia em lote. */
+#define LIMITE_DISTANCIAS (1 << 24)
+
+/** Tamanho máximo de uma linha do ficheiro de consultas. */
+#define TAMANHO_LINHA 256
+
+/**
+ * @enum TipoConsulta
+ * @brief Tipos de consulta aceites no ficheiro.
+ */
+
+typedef enum TipoConsulta {
+    CONSULTA_INVALIDA,
+    CONSULTA_ALCANCE,
+    CONSULTA_CAMINHO,
+    CONSULTA_INTERSECOES
+} TipoConsulta;
+
+/**
+ * @struct Consulta
+ * @brief Consulta lida do ficheiro e o respetivo resultado.
+ */
+
+typedef struct Consulta {
+    TipoConsulta tipo;      /**< Tipo da consulta */
+    int linha;              /**< Linha do ficheiro de origem */
+    int origem, destino;    /**< Índices CSR das antenas (alcance e caminho) */
+    Frequencia freqA, freqB;/**< Frequências (interseções) */
+    int inicioCaminho;      /**< Início do caminho em `caminhos`, ou -1 se não existir */
+    int comprimento;        /**< Número de vértices do caminho */
+} Consulta;
+
+/**
+ * @struct PedidoOrigem
+ * @brief Associação entre uma consulta de caminho e a sua origem, para ordenação.
+ */
+
+typedef struct PedidoOrigem {
+    int origem;     /**< Índice CSR da origem */
+    int consulta;   /**< Índice da consulta */
+} PedidoOrigem;
+
+/**
+ * @brief Compara dois pedidos pela origem (e pela ordem no ficheiro).
+ *
+ * @param a Primeiro pedido.
+ * @param b Segundo pedido.
+ * @return Negativo, zero ou positivo, como em `qsort`.
+ */
+
+static int compararPedidos(const void *a, const void *b) {
+
+    const PedidoOrigem *p = (const PedidoOrigem *)a;
+    const PedidoOrigem *q = (const PedidoOrigem *)b;
+
+    if (p -> origem != q -> origem) return p -> origem < q -> origem ? -1 : 1;
+    return (p -> consulta > q -> consulta) - (p -> consulta < q -> consulta);
+
+}
+
+/**
+ * @brief Atribui a cada vértice o identificador da sua componente ligada.
+ *
+ * @param g Grafo compacto.
+ * @param componente Vetor de numVertices entradas a preencher.
+ * @return true em caso de sucesso, false em caso de falha de memória.
+ */
+
+static bool calcularComponentes(const GrafoCSR *g, int *componente) {
+
+    int n = g -> numVertices;
+    int *fila = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!fila) {
+        return false;
+    }
+
+    for (int v = 0; v < n; v++) componente[v] = -1;
+
+    int atual = 0;
+    for (int s = 0; s < n; s++) {
+
+        if (componente[s] >= 0) continue;
+
+        int inicio = 0, fim = 0;
+        fila[fim++] = s;
+        componente[s] = atual;
+
+        while (inicio < fim) {
+            int v = fila[inicio++];
+            for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+                int u = g -> destinos[k];
+                if (componente[u] < 0) {
+                    componente[u] = atual;
+                    fila[fim++] = u;
+                }
+            }
+        }
+
+        atual++;
+
+    }
+
+    free(fila);
+
+    return true;
+
+}
+
+/**
+ * @brief Lê e interpreta o ficheiro de consultas.
+ *
+ * @param g Grafo compacto.
+ * @param ficheiro Ficheiro aberto para leitura.
+ * @param total Recebe o número de consultas lidas.
+ * @return Vetor de consultas (pode ter 0 entradas), ou false em caso de falha de memória.
+ */
+
+static Consulta *lerConsultas(const GrafoCSR *g, FILE *ficheiro, long *total) {
+
+    long capacidade = 64, n = 0;
+    Consulta *consultas = (Consulta *)malloc(capacidade * sizeof(Consulta));
+    if (!consultas) {
+        return false;
+    }
+
+    char linha[TAMANHO_LINHA], comando[32];
+    int numeroLinha = 0;
+
+    while (fgets(linha, sizeof(linha), ficheiro)) {
+
+        numeroLinha++;
+        if (sscanf(linha, "%31s", comando) != 1 || comando[0] == '#') continue;
+
+        if (n == capacidade) {
+            Consulta *maior = (Consulta *)realloc(consultas, 2 * capacidade * sizeof(Consulta));
+            if (!maior) {
+                free(consultas);
+                return false;
+            }
+            consultas = maior;
+            capacidade *= 2;
+        }
+
+        Consulta *c = &consultas[n++];
+        memset(c, 0, sizeof(Consulta));
+        c -> linha = numeroLinha;
+        c -> inicioCaminho = -1;
+
+        const char *args = strstr(linha, comando) + strlen(comando);
+        int x1, y1, x2, y2;
+        char nomeA[TAMANHO_NOME_FREQUENCIA], nomeB[TAMANHO_NOME_FREQUENCIA];
+
+        if (strcmp(comando, "alcance") == 0 || strcmp(comando, "caminho") == 0) {
+
+            if (sscanf(args, "%d %d %d %d", &x1, &y1, &x2, &y2) == 4) {
+                c -> origem = indiceVerticeCSR(g, x1, y1);
+                c -> destino = indiceVerticeCSR(g, x2, y2);
+                if (c -> origem >= 0 && c -> destino >= 0) {
+                    c -> tipo = comando[0] == 'a' ? CONSULTA_ALCANCE : CONSULTA_CAMINHO;
+                }
+            }
+
+        } else if (strcmp(comando, "intersecoes") == 0) {
+
+            // Um nome desconhecido não é registado: fica FREQUENCIA_QUALQUER, um grupo vazio
+            // (`verticesFrequencia` devolve 0 para qualquer frequência fora do agrupamento)
+            if (sscanf(args, "%31s %31s", nomeA, nomeB) == 2) {
+                if (!procurarFrequencia(nomeA, &c -> freqA)) c -> freqA = FREQUENCIA_QUALQUER;
+                if (!procurarFrequencia(nomeB, &c -> freqB)) c -> freqB = FREQUENCIA_QUALQUER;
+                c -> tipo = CONSULTA_INTERSECOES;
+            }
+
+        }
+
+    }
+
+    *total = n;
+
+    return consultas;
+
+}
+
+/**
+ * @brief Resolve todas as consultas de caminho, agrupando-as por origem.
+ *
+ * As origens distintas são processadas em travessias em lote; para cada consulta,
+ * o caminho é reconstruído do destino para a origem, escolhendo em cada passo um
+ * vizinho a distância uma unidade menor.
+ *
+ * @param g Grafo compacto.
+ * @param consultas Consultas lidas.
+ * @param total Número de consultas.
+ * @param componente Componente ligada de cada vértice.
+ * @param caminhos Recebe o vetor com os vértices de todos os caminhos.
+ * @param resumo Estatísticas a atualizar.
+ * @return true em caso de sucesso, false em caso de falha de memória.
+ */
+
+static bool resolverCaminhos(const GrafoCSR *g, Consulta *consultas, long total,
+                             const int *componente, int **caminhos, ResumoLote *resumo) {
+
+    long numPedidos = 0;
+    for (long i = 0; i < total; i++) {
+        Consulta *c = &consultas[i];
+        if (c -> tipo == CONSULTA_CAMINHO && componente[c -> origem] == componente[c -> destino]) numPedidos++;
+    }
+
+    *caminhos = NULL;
+    if (numPedidos == 0) {
+        return true;
+    }
+
+    PedidoOrigem *pedidos = (PedidoOrigem *)malloc(numPedidos * sizeof(PedidoOrigem));
+    int *origens = (int *)malloc(ORIGENS_POR_LOTE * sizeof(int));
+    long capacidade = 1024, usados = 0;
+    int *vertices = (int *)malloc(capacidade * sizeof(int));
+
+    if (!pedidos || !origens || !vertices) {
+        free(pedidos);
+        free(origens);
+        free(vertices);
+        return false;
+    }
+
+    long k = 0;
+    for (long i = 0; i < total; i++) {
+        Consulta *c = &consultas[i];
+        if (c -> tipo == CONSULTA_CAMINHO && componente[c -> origem] == componente[c -> destino]) {
+            pedidos[k].origem = c -> origem;
+            pedidos[k].consulta = (int)i;
+            k++;
+        }
+    }
+    qsort(pedidos, numPedidos, sizeof(PedidoOrigem), compararPedidos);
+
+    // Origens por travessia, limitadas para a tabela de distâncias caber no orçamento
+    int n = g -> numVertices;
+    int porTravessia = ORIGENS_POR_LOTE;
+    if ((long)porTravessia * n > LIMITE_DISTANCIAS) {
+        porTravessia = n > 0 ? (int)(LIMITE_DISTANCIAS / n) : 1;
+        if (porTravessia < 1) porTravessia = 1;
+    }
+
+    bool sucesso = true;
+    long p = 0;
+    while (p < numPedidos && sucesso) {
+
+        // Reúne até porTravessia origens distintas consecutivas
+        int numOrigens = 0;
+        long fimGrupo = p;
+        while (fimGrupo < numPedidos) {
+            if (fimGrupo == p || pedidos[fimGrupo].origem != pedidos[fimGrupo - 1].origem) {
+                if (numOrigens == porTravessia) break;
+                origens[numOrigens++] = pedidos[fimGrupo].origem;
+            }
+            fimGrupo++;
+        }
+
+        DistanciasLargura *d = procuraLarguraMultipla(g, origens, numOrigens);
+        if (!d) {
+            sucesso = false;
+            break;
+        }
+        resumo -> procurasLargura++;
+
+        int o = -1;
+        for (long i = p; i < fimGrupo; i++) {
+
+            if (i == p || pedidos[i].origem != pedidos[i - 1].origem) o++;
+
+            Consulta *c = &consultas[pedidos[i].consulta];
+            int dist = distanciaLargura(d, o, c -> destino);
+            if (dist < 0) continue;
+
+            if (usados + dist + 1 > capacidade) {
+                while (usados + dist + 1 > capacidade) capacidade *= 2;
+                int *maior = (int *)realloc(vertices, capacidade * sizeof(int));
+                if (!maior) {
+                    sucesso = false;
+                    break;
+                }
+                vertices = maior;
+            }
+
+            // Reconstrói o caminho do destino para a origem
+            int v = c -> destino;
+            vertices[usados + dist] = v;
+            bool completo = true;
+            for (int passo = dist; passo > 0 && completo; passo--) {
+                completo = false;
+                for (int a = g -> inicioArestas[v]; a < g -> inicioArestas[v + 1]; a++) {
+                    int u = g -> destinos[a];
+                    if (distanciaLargura(d, o, u) == passo - 1) {
+                        v = u;
+                        vertices[usados + passo - 1] = v;
+                        completo = true;
+                        break;
+                    }
+                }
+            }
+
+            if (completo) {
+                c -> inicioCaminho = (int)usados;
+                c -> comprimento = dist + 1;
+                usados += dist + 1;
+            }
+
+        }
+
+        libertarDistanciasLargura(d);
+        p = fimGrupo;
+
+    }
+
+    free(pedidos);
+    free(origens);
+
+    if (!sucesso) {
+        free(vertices);
+        return false;
+    }
+
+    *caminhos = vertices;
+
+    return true;
+
+}
+
+/**
+ * @brief Executa um ficheiro de consultas e escreve os resultados noutro ficheiro.
+ *
+ * @param g Grafo compacto.
+ * @param ficheiroConsultas Ficheiro com uma consulta por linha.
+ * @param ficheiroResultados Ficheiro onde escrever os resultados.
+ * @param resumo Recebe as estatísticas da execução (pode ser NULL).
+ * @return true em caso de sucesso, false se algum ficheiro não puder ser aberto ou faltar memória.
+ */
+
+bool executarLote(const GrafoCSR *g, const char *ficheiroConsultas, const char *ficheiroResultados, ResumoLote *resumo) {
+
+    ResumoLote local;
+    if (!resumo) resumo = &local;
+    memset(resumo, 0, sizeof(ResumoLote));
+
+    if (!g) {
+        return false;
+    }
+
+    double inicio = tempoAtual();
+
+    FILE *entrada = fopen(ficheiroConsultas, "r");
+    if (!entrada) {
+        return false;
+    }
+
+    Consulta *consultas = lerConsultas(g, entrada, &resumo -> consultas);
+    fclose(entrada);
+    if (!consultas) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    int *componente = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    GruposFrequencia *grupos = agruparFrequenciasCSR(g);
+    int *caminhos = NULL;
+
+    if (!componente || !grupos || !calcularComponentes(g, componente) ||
+        !resolverCaminhos(g, consultas, resumo -> consultas, componente, &caminhos, resumo)) {
+        free(componente);
+        libertarGruposFrequencia(grupos);
+        free(consultas);
+        return false;
+    }
+
+    FILE *saida = fopen(ficheiroResultados, "w");
+    char *tampao = (char *)malloc(TAMPAO_RESULTADOS);
+    if (!saida) {
+        free(tampao);
+        free(caminhos);
+        free(componente);
+        libertarGruposFrequencia(grupos);
+        free(consultas);
+        return false;
+    }
+    if (tampao) setvbuf(saida, tampao, _IOFBF, TAMPAO_RESULTADOS);
+
+    for (long i = 0; i < resumo -> consultas; i++) {
+
+        Consulta *c = &consultas[i];
+
+        switch (c -> tipo) {
+
+            case CONSULTA_ALCANCE:
+                fprintf(saida, "[%d] %s\n", c -> linha, componente[c -> origem] == componente[c -> destino] ? "sim" : "nao");
+                break;
+
+            case CONSULTA_CAMINHO:
+                if (c -> inicioCaminho < 0) {
+                    fprintf(saida, "[%d] sem caminho\n", c -> linha);
+                    break;
+                }
+                fprintf(saida, "[%d] ", c -> linha);
+                for (int k = 0; k < c -> comprimento; k++) {
+                    int v = caminhos[c -> inicioCaminho + k];
+                    fprintf(saida, "%s(%d, %d)", k > 0 ? " -> " : "", g -> x[v], g -> y[v]);
+                }
+                fputc('\n', saida);
+                break;
+
+            case CONSULTA_INTERSECOES: {
+                // Com A == B, cada par não ordenado sai uma vez e sem pares de uma antena consigo
+                const int *grupoA = NULL, *grupoB = NULL;
+                int numA = verticesFrequencia(grupos, c -> freqA, &grupoA);
+                int numB = verticesFrequencia(grupos, c -> freqB, &grupoB);
+                bool iguais = c -> freqA == c -> freqB;
+                long pares = iguais ? (long)numA * (numA - 1) / 2 : (long)numA * numB;
+                fprintf(saida, "[%d] %ld pares\n", c -> linha, pares);
+                for (int a = 0; a < numA; a++) {
+                    int u = grupoA[a];
+                    for (int b = iguais ? a + 1 : 0; b < numB; b++) {
+                        int v = grupoB[b];
+                        fprintf(saida, "(%d, %d) <-> (%d, %d)\n", g -> x[u], g -> y[u], g -> x[v], g -> y[v]);
+                    }
+                }
+                break;
+            }
+
+            default:
+                fprintf(saida, "[%d] erro consulta invalida ou antena inexistente\n", c -> linha);
+                resumo -> invalidas++;
+                break;
+
+        }
+
+    }
+
+    fclose(saida);
+    free(tampao);
+    free(caminhos);
+    free(componente);
+    libertarGruposFrequencia(grupos);
+    free(consultas);
+
+    resumo -> tempo = tempoAtual() - inicio;
+
+    return true;
+
+}
@@ -0,0 +1,44 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file lote.h
+ * @author Thiago Abreu
+ * @brief Execução de um ficheiro de consultas em lote sobre o grafo compacto.
+ *
+ * Cada linha do ficheiro é uma consulta:
+ *  - `alcance x1 y1 x2 y2`: indica se as duas antenas estão ligadas;
+ *  - `caminho x1 y1 x2 y2`: caminho mais curto entre as duas antenas;
+ *  - `intersecoes A B`: pares de antenas com as frequências A e B.
+ *
+ * Linhas vazias ou começadas por '#' são ignoradas. As consultas são agrupadas
+ * por tipo e por origem para partilhar o trabalho comum, mas os resultados são
+ * escritos pela ordem do ficheiro, cada um precedido de "[linha]".
+ */
+
+#ifndef LOTE_H
+#define LOTE_H
+
+#include <stdbool.h>
+#include "grafocsr.h"
+
+/**
+ * @struct ResumoLote
+ * @brief Estatísticas de uma execução em lote.
+ */
+
+typedef struct ResumoLote {
+    long consultas;         /**< Consultas lidas */
+    long invalidas;         /**< Consultas mal formadas ou com antenas inexistentes */
+    long procurasLargura;   /**< Travessias em lote executadas para os caminhos */
+    double tempo;           /**< Tempo total, em segundos */
+} ResumoLote;
+
+bool executarLote(const GrafoCSR *g, const char *ficheiroConsultas, const char *ficheiroResultados, ResumoLote *resumo);
+
+#endif
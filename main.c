@@ -12,11 +12,129 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #include "funcoes.h"
 #include "grafo.h"
+#include "benchmark.h"
+#include "gerador.h"
+#include "verificacao.h"
+#include "tarefas.h"
+#include "servidor.h"
+#include "grafocsr.h"
+#include "lote.h"
+#include "saida.h"
+#include "instrumentacao.h"
+#include "ordenacao.h"
 
-int main() {
+int main(int argc, char *argv[]) {
+
+    // Opções: -t/--threads N (threads do conjunto partilhado), --benchmark,
+    // --servidor (comandos pela entrada padrão), --socket caminho, --mapa ficheiro,
+    // --lote consultas resultados, --instrumentacao relatorio.json (ou EDA_INSTRUMENTACAO),
+    // --gerar-mapa ficheiro linhas colunas, --verificar N [semente],
+    // --ordenado (resultados da demonstração ordenados por (x, y))
+    bool benchmark = false, servidor = false, ordenado = false;
+    int casosVerificacao = 0;
+    unsigned int sementeVerificacao = 2025u;
+    const char *caminhoSocket = NULL;
+    const char *mapa = "uploadantenas.txt";
+    const char *consultas = NULL, *resultados = NULL;
+    const char *relatorio = getenv("EDA_INSTRUMENTACAO");
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-t") == 0 || strcmp(argv[i], "--threads") == 0) && i + 1 < argc) {
+            definirNumThreadsGlobal(atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--benchmark") == 0) {
+            benchmark = true;
+        } else if (strcmp(argv[i], "--ordenado") == 0) {
+            ordenado = true;
+        } else if (strcmp(argv[i], "--servidor") == 0) {
+            servidor = true;
+        } else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            servidor = true;
+            caminhoSocket = argv[++i];
+        } else if (strcmp(argv[i], "--mapa") == 0 && i + 1 < argc) {
+            mapa = argv[++i];
+        } else if (strcmp(argv[i], "--gerar-mapa") == 0 && i + 3 < argc) {
+            // Mapa com 5% de antenas, 8 frequências e agrupamento 0.5
+            ParametrosMapa p = { atoi(argv[i + 2]), atoi(argv[i + 3]), 0.05, 8, 0.5, 2025u };
+            bool escrito = gerarMapa(argv[i + 1], p);
+            printf(escrito ? "Mapa %s gerado.\n" : "Erro ao gerar o mapa %s.\n", argv[i + 1]);
+            return escrito ? 0 : 1;
+        } else if (strcmp(argv[i], "--verificar") == 0 && i + 1 < argc) {
+            casosVerificacao = atoi(argv[++i]);
+            if (i + 1 < argc && argv[i + 1][0] != '-') sementeVerificacao = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--instrumentacao") == 0 && i + 1 < argc) {
+            relatorio = argv[++i];
+        } else if (strcmp(argv[i], "--lote") == 0 && i + 2 < argc) {
+            consultas = argv[++i];
+            resultados = argv[++i];
+        } else {
+            printf("Opção desconhecida: %s\n", argv[i]);
+            printf("Uso: %s [-t N | --threads N] [--benchmark] [--servidor | --socket caminho] [--lote consultas resultados] [--mapa ficheiro] [--instrumentacao relatorio] [--gerar-mapa ficheiro linhas colunas] [--verificar N [semente]] [--ordenado]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (relatorio && !iniciarInstrumentacao(relatorio)) {
+        printf("Instrumentação indisponível: compile com -DINSTRUMENTACAO.\n");
+    }
+
+    if (casosVerificacao > 0) {
+        bool sucesso = verificarMotores(casosVerificacao, sementeVerificacao, poolGlobal());
+        libertarPoolGlobal();
+        return sucesso ? 0 : 1;
+    }
+
+    if (benchmark) {
+        benchmarkLarguraParalela(poolGlobal());
+        benchmarkEscalabilidade(poolGlobal());
+        libertarPoolGlobal();
+        return 0;
+    }
+
+    if (consultas) {
+        int l = 0, c = 0;
+        Vertice *g = carregarGrafo(mapa, &l, &c);
+        GrafoCSR *csr = construirGrafoCSR(g);
+        ResumoLote resumo;
+        bool sucesso = executarLote(csr, consultas, resultados, &resumo);
+        if (sucesso) {
+            printf("%ld consultas (%ld invalidas), %ld travessias em lote, %.3f s\n",
+                   resumo.consultas, resumo.invalidas, resumo.procurasLargura, resumo.tempo);
+        } else {
+            printf("Erro ao executar o lote %s.\n", consultas);
+        }
+        libertarGrafoCSR(csr);
+        libertarGrafo(g);
+        return sucesso ? 0 : 1;
+    }
+
+    if (servidor) {
+        EstadoMapa estado;
+        if (!carregarEstadoMapa(&estado, mapa)) {
+            printf("Erro ao carregar o mapa %s.\n", mapa);
+            return 1;
+        }
+        bool sucesso = true;
+        if (caminhoSocket) {
+            sucesso = executarServidorSocket(&estado, caminhoSocket);
+            if (!sucesso) printf("Erro ao criar o socket %s.\n", caminhoSocket);
+        } else {
+            executarServidor(&estado, stdin, stdout);
+        }
+        libertarEstadoMapa(&estado);
+        libertarPoolGlobal();
+        return sucesso ? 0 : 1;
+    }
+
+    // Toda a saída da demonstração passa por um tampão único, descarregado no fim
+    Saida *out = criarSaida(stdout, CAPACIDADE_SAIDA_PADRAO);
+    if (!out) {
+        printf("Erro ao reservar memória para a saída.\n");
+        return 1;
+    }
 
     int linhas = 0, colunas = 0;
     Vertice *grafo = NULL;
@@ -27,15 +145,16 @@ int main() {
     // Fase 1: 2.
     Antena *lista = carregarAntenas("uploadantenas.txt", &linhas, &colunas);
     if (!lista) {
-        printf("Erro ao carregar antenas do ficheiro.\n");
+        escreverFormatado(out, "Erro ao carregar antenas do ficheiro.\n");
+        libertarSaida(out);
         return false;
     }
     // Fase 1: 3.A
-    lista = inserirAntena(lista, 'Z', 2, 3);
+    lista = inserirAntena(lista, frequenciaCaracter('Z'), 2, 3);
     if (!lista) {
-        printf("Erro: Antena não pôde ser inserida (duplicada ou falha de memória).\n");
+        escreverFormatado(out, "Erro: Antena não pôde ser inserida (duplicada ou falha de memória).\n");
     } else {
-        printf("Antena 'Z' inserida em (2, 3).\n");
+        escreverFormatado(out, "Antena 'Z' inserida em (2, 3).\n");
     }
 
 
@@ -43,44 +162,51 @@ int main() {
     bool removido = false;
     lista = removerAntena(lista, 3, 5, &removido);
     if (removido) {
-        printf("Antena removida com sucesso.\n");
+        escreverFormatado(out, "Antena removida com sucesso.\n");
     } else {
-        printf("Nenhuma antena encontrada em (3, 5).\n");
+        escreverFormatado(out, "Nenhuma antena encontrada em (3, 5).\n");
     }
 
     //Fase 1: 3.C
     Coordenada *nefastos = detectarLocaisNefastos(lista);
-    while (nefastos) {
-        printf("Efeito nefasto em (%d, %d)\n", nefastos->x, nefastos->y);
-        nefastos = nefastos->proximo;
+    if (ordenado) nefastos = ordenarCoordenadas(nefastos);
+    for (Coordenada *n = nefastos; n != NULL; n = n->proximo) {
+        escreverTexto(out, "Efeito nefasto em ");
+        escreverCoordenada(out, n->x, n->y);
+        escreverCaracter(out, '\n');
     }
 
     // Fase 1: 3.D
-    printf("\n=======================\n");
-    printf(" TABELA DE ANTENAS\n");
-    printf("=======================\n");
-    printf("| FREQ |  X  |  Y  |\n");
-    printf("=======================\n");
+    escreverFormatado(out, "\n=======================\n");
+    escreverFormatado(out, " TABELA DE ANTENAS\n");
+    escreverFormatado(out, "=======================\n");
+    escreverFormatado(out, "| FREQ |  X  |  Y  |\n");
+    escreverFormatado(out, "=======================\n");
 
     for (Antena *a = lista; a != NULL; a = a->proximo) {
-        printf("|  %c   | %2d  | %2d  |\n", a->frequencia, a->x, a->y);
+        escreverFormatado(out, "|  %s   | %2d  | %2d  |\n", nomeFrequencia(a->frequencia), a->x, a->y);
     }
 
-    printf("\n===============================\n");
-    printf(" LOCAIS COM EFEITO NEFASTO\n");
-    printf("===============================\n");
-    printf("|   X   |   Y   |\n");
-    printf("===============================\n");
+    escreverFormatado(out, "\n===============================\n");
+    escreverFormatado(out, " LOCAIS COM EFEITO NEFASTO\n");
+    escreverFormatado(out, "===============================\n");
+    escreverFormatado(out, "|   X   |   Y   |\n");
+    escreverFormatado(out, "===============================\n");
 
     for (Coordenada *n = nefastos; n != NULL; n = n->proximo) {
-        printf("|  %2d   |  %2d   |\n", n->x, n->y);
+        escreverFormatado(out, "|  %2d   |  %2d   |\n", n->x, n->y);
     }
 
+    escreverFormatado(out, "\n===============================\n");
+    escreverFormatado(out, " MAPA ANOTADO (# = efeito nefasto)\n");
+    escreverFormatado(out, "===============================\n");
+    escreverMapaAnotado(out, lista, nefastos, linhas, colunas);
+
     // Fase 2: 1.
-    grafo = inserirVertice(grafo, 'A', 1, 1);
-    grafo = inserirVertice(grafo, 'A', 2, 2);
-    grafo = inserirVertice(grafo, 'A', 3, 3);
-    grafo = inserirVertice(grafo, 'B', 5, 5);
+    grafo = inserirVertice(grafo, frequenciaCaracter('A'), 1, 1);
+    grafo = inserirVertice(grafo, frequenciaCaracter('A'), 2, 2);
+    grafo = inserirVertice(grafo, frequenciaCaracter('A'), 3, 3);
+    grafo = inserirVertice(grafo, frequenciaCaracter('B'), 5, 5);
 
         // Apenas estas vão conectar:
     conectarVertices(grafo, 1, 1, 2, 2); // Frequência 'A'
@@ -93,92 +219,97 @@ int main() {
     grafo = carregarGrafo("uploadantenas.txt", &linhas, &colunas);
 
     if (!grafo) {
-        printf("Erro ao carregar o grafo a partir do ficheiro.\n");
+        escreverFormatado(out, "Erro ao carregar o grafo a partir do ficheiro.\n");
+        libertarSaida(out);
         return false;
     }
 
-    printf("Grafo carregado com sucesso (%d linhas x %d colunas):\n", linhas, colunas);
-    printf("===============================\n");
-    printf("| FREQ |   X   |   Y   |\n");
-    printf("===============================\n");
+    escreverFormatado(out, "Grafo carregado com sucesso (%d linhas x %d colunas):\n", linhas, colunas);
+    escreverFormatado(out, "===============================\n");
+    escreverFormatado(out, "| FREQ |   X   |   Y   |\n");
+    escreverFormatado(out, "===============================\n");
 
     for (Vertice *v = grafo; v != NULL; v = v->proximo) {
-        printf("|  %c   |  %2d   |  %2d   |\n", v->frequencia, v->x, v->y);
+        escreverFormatado(out, "|  %s   |  %2d   |  %2d   |\n", nomeFrequencia(v->frequencia), v->x, v->y);
     }
 
     // Fase 2: 3.A
     Coordenada *alcancados = procuraProfundidade(grafo, 5, 6);
+    if (ordenado) alcancados = ordenarCoordenadas(alcancados);
 
     if (!alcancados) {
-        printf("Nenhuma antena encontrada ou nenhum caminho a partir da posição (5, 6).\n");
+        escreverFormatado(out, "Nenhuma antena encontrada ou nenhum caminho a partir da posição (5, 6).\n");
     } else {
-        printf("Antenas alcançadas a partir de (5, 6):\n");
-        printf("=========================\n");
-        printf("|   X   |   Y   |\n");
-        printf("=========================\n");
+        escreverFormatado(out, "Antenas alcançadas a partir de (5, 6):\n");
+        escreverFormatado(out, "=========================\n");
+        escreverFormatado(out, "|   X   |   Y   |\n");
+        escreverFormatado(out, "=========================\n");
         Coordenada *atual = alcancados;
         while (atual) {
-            printf("|  %2d   |  %2d   |\n", atual->x, atual->y);
+            escreverFormatado(out, "|  %2d   |  %2d   |\n", atual->x, atual->y);
             atual = atual->proximo;
         }
-        printf("=========================\n");
+        escreverFormatado(out, "=========================\n");
     }
 
     // Fase 2: 3.B
     int origemX = 5, origemY = 6;
     alcancados = procuraLargura(grafo, origemX, origemY);
+    if (ordenado) alcancados = ordenarCoordenadas(alcancados);
 
     if (!alcancados) {
-        printf("Antena inicial não encontrada ou nenhuma conexão em largura.\n");
+        escreverFormatado(out, "Antena inicial não encontrada ou nenhuma conexão em largura.\n");
     } else {
-        printf("Antenas alcançadas em largura a partir de (%d, %d):\n", origemX, origemY);
-        printf("=========================\n");
-        printf("|   X   |   Y   |\n");
-        printf("=========================\n");
+        escreverFormatado(out, "Antenas alcançadas em largura a partir de (%d, %d):\n", origemX, origemY);
+        escreverFormatado(out, "=========================\n");
+        escreverFormatado(out, "|   X   |   Y   |\n");
+        escreverFormatado(out, "=========================\n");
 
         Coordenada *atual = alcancados;
         while (atual) {
-            printf("|  %2d   |  %2d   |\n", atual->x, atual->y);
+            escreverFormatado(out, "|  %2d   |  %2d   |\n", atual->x, atual->y);
             atual = atual->proximo;
         }
-        printf("=========================\n");
+        escreverFormatado(out, "=========================\n");
     }
 
     // Fase 2: 3.C
     Coordenada *todosCaminhos = caminhosEntreAntenas(grafo, 5, 6, 9, 9);
     if (!todosCaminhos) {
-        printf("Nenhum caminho encontrado entre (5, 6) e (9, 9).\n");
+        escreverFormatado(out, "Nenhum caminho encontrado entre (5, 6) e (9, 9).\n");
         libertarGrafo(grafo);
+        libertarSaida(out);
         return 0;
     }
 
-    printf("Caminhos encontrados entre (5, 6) e (9, 9):\n");
+    escreverFormatado(out, "Caminhos encontrados entre (5, 6) e (9, 9):\n");
 
     Coordenada *atual = todosCaminhos;
     while (atual) {
-        printf("(%d, %d)", atual->x, atual->y);
+        escreverCoordenada(out, atual->x, atual->y);
         if (atual->proximo && !(atual->proximo->x == 0 && atual->proximo->y == 0)) {
-            printf(" -> ");
+            escreverTexto(out, " -> ");
         } else {
-            printf("\n");
+            escreverCaracter(out, '\n');
         }
         atual = atual->proximo;
     }
 
     // Fase 2: 3.D
-    char freqA = 'A';
-    char freqB = 'O';
+    Frequencia freqA = frequenciaCaracter('A');
+    Frequencia freqB = frequenciaCaracter('O');
 
     Coordenada *pares = intersecoesFrequencias(grafo, freqA, freqB);
+    if (ordenado) pares = ordenarParesCoordenadas(pares);
 
     if (!pares) {
-        printf("Nenhuma interseção encontrada entre frequências %c e %c.\n", freqA, freqB);
+        escreverFormatado(out, "Nenhuma interseção encontrada entre frequências %s e %s.\n", nomeFrequencia(freqA), nomeFrequencia(freqB));
     } else {
-        printf("Pares de antenas com frequências %c e %c:\n", freqA, freqB);
-        Coordenada *atual = pares;
-        while (atual && atual->proximo) {
-            printf("(%d, %d) ↔ (%d, %d)\n", atual->x, atual->y, atual->proximo->x, atual->proximo->y);
-            atual = atual->proximo->proximo;
+        escreverFormatado(out, "Pares de antenas com frequências %s e %s:\n", nomeFrequencia(freqA), nomeFrequencia(freqB));
+        Coordenada *par = pares;
+        while (par && par->proximo) {
+            escreverFormatado(out, "(%d, %d) ↔ (%d, %d)\n", par->x, par->y, par->proximo->x, par->proximo->y);
+            par = par->proximo->proximo;
         }
     }
 
@@ -189,6 +320,7 @@ int main() {
     libertarCoordenadas(pares);
     libertarCoordenadas(alcancados);
     libertarGrafo(grafo);
+    libertarSaida(out);
 
     return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -17,9 +17,100 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
 #include "funcoes.h"
 #include "antenas.h"
 #include "nefastos.h"
+#include "instrumentacao.h"
+
+/** Área máxima (em células) do mapa de bits da deteção paralela. */
+#define LIMITE_CELULAS_PARALELO (1LL << 30)
+
+/** Antenas de partida por tarefa na deteção paralela. */
+#define GRAO_NEFASTOS 32
+
+/** Capacidade inicial da tabela de retas já marcadas no modo colinear. */
+#define CAPACIDADE_RETAS 1024
+
+/**
+ * @struct Reta
+ * @brief Reta da grelha, na forma sy * x - sx * y = c, com (sx, sy) primitivo e normalizado.
+ */
+
+typedef struct Reta {
+    int sx, sy;        /**< Passo entre células consecutivas da reta */
+    long long c;       /**< Constante que distingue retas paralelas */
+    bool usada;        /**< true se a entrada da tabela está ocupada */
+} Reta;
+
+/**
+ * @struct TabelaRetas
+ * @brief Conjunto (tabela de dispersão aberta) das retas já marcadas.
+ */
+
+typedef struct TabelaRetas {
+    Reta *entradas;    /**< Entradas da tabela */
+    int capacidade;    /**< Tamanho da tabela (potência de 2) */
+    int ocupadas;      /**< Entradas ocupadas */
+} TabelaRetas;
+
+/**
+ * @struct EstadoNefastos
+ * @brief Dados partilhados pelas tarefas da deteção paralela.
+ */
+
+typedef struct EstadoNefastos {
+    Antena **antenas;             /**< Antenas agrupadas por frequência, pela ordem da lista */
+    int *fimGrupo;                /**< Para cada posição, o fim do grupo da sua frequência */
+    int minX, minY;               /**< Canto do retângulo que contém todas as antenas */
+    long long largura;            /**< Número de colunas do retângulo */
+    _Atomic uint64_t *marcados;   /**< Mapa de bits das posições nefastas */
+} EstadoNefastos;
+
+/**
+ * @brief Agrupa as antenas por frequência (ordenação por contagem, estável).
+ *
+ * O grupo da frequência `f` ocupa `grupos[inicio[f]]` até `grupos[inicio[f + 1] - 1]`,
+ * pela ordem da lista.
+ *
+ * @param lista Lista ligada de antenas.
+ * @param grupos Vetor com espaço para todas as antenas da lista.
+ * @param fimGrupo Se não for NULL, recebe para cada posição o fim do grupo respetivo.
+ * @return Vetor `inicio` com numFrequencias() + 1 entradas (a libertar pelo chamador),
+ *         ou NULL em caso de falha de memória.
+ */
+
+static int *agruparPorFrequencia(Antena *lista, Antena **grupos, int *fimGrupo) {
+
+    int nf = numFrequencias();
+    int *inicio = (int *)calloc(nf + 1, sizeof(int));
+    int *posicao = (int *)malloc((nf > 0 ? nf : 1) * sizeof(int));
+    if (!inicio || !posicao) {
+        free(inicio);
+        free(posicao);
+        return NULL;
+    }
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+        inicio[a -> frequencia + 1]++;
+    }
+    for (int f = 0; f < nf; f++) {
+        inicio[f + 1] += inicio[f];
+        posicao[f] = inicio[f];
+    }
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+        int f = a -> frequencia;
+        if (fimGrupo) fimGrupo[posicao[f]] = inicio[f + 1];
+        grupos[posicao[f]++] = a;
+    }
+
+    free(posicao);
+
+    return inicio;
+
+}
 
 /**
  * @brief Detecta locais nefastos com base na regra de alinhamento e distância.
@@ -28,32 +119,454 @@
  * a exatamente o dobro da distância da outra, e marca a posição intermediária.
  * A posição central é considerada "nefasta" e adicionada à lista.
  *
+ * As antenas são primeiro agrupadas pelo identificador da frequência, pelo que só
+ * se formam pares dentro de cada grupo.
+ *
  * @param lista Lista ligada de antenas.
- * @return Lista de coordenadas com efeito nefasto.
+ * @return Lista de coordenadas com efeito nefasto, ou NULL se não houver nenhuma ou faltar memória.
  */
 
  Coordenada *detectarLocaisNefastos(Antena *lista) {
+    INSTR_INICIO(inicioDetecao);
     Coordenada *nefastos = NULL;
 
-    for (Antena *a1 = lista; a1 != NULL; a1 = a1->proximo) {
+    int n = 0;
+    for (Antena *a = lista; a; a = a -> proximo) n++;
+
+    Antena **grupos = (Antena **)malloc((n > 0 ? n : 1) * sizeof(Antena *));
+    int *inicio = grupos ? agruparPorFrequencia(lista, grupos, NULL) : NULL;
+    if (!inicio) {
+        free(grupos);
+        INSTR_FIM(CRONOMETRO_NEFASTOS, inicioDetecao);
+        return nefastos;
+    }
+
+    bool semMemoria = false;
+    int nf = numFrequencias();
+    for (int f = 0; f < nf && !semMemoria; f++) {
+
+        for (int i = inicio[f]; i < inicio[f + 1] && !semMemoria; i++) {
+
+            Antena *a1 = grupos[i];
+
+            for (int j = i + 1; j < inicio[f + 1]; j++) {
+
+                Antena *a2 = grupos[j];
+                INSTR_CONTAR(CONTADOR_PARES_NEFASTOS, 1);
+
+                int dx = a2 -> x - a1 -> x;
+                int dy = a2 -> y - a1 -> y;
+
+                // a2 está o dobro da distância de a1
+                if(dx % 2 == 0 && dy % 2 == 0) {
+                    int mx = a1 -> x + dx / 2;
+                    int my = a1 -> y + dy / 2;
+                    Coordenada *nova = adicionarPosicao(nefastos, mx, my);
+                    if (!nova) {
+                        semMemoria = true;
+                        break;
+                    }
+                    nefastos = nova;
+
+                }
+            }
+        }
+    }
+
+    free(inicio);
+    free(grupos);
 
-        for (Antena *a2 = a1 -> proximo; a2 != NULL; a2 = a2 -> proximo) {
+    INSTR_FIM(CRONOMETRO_NEFASTOS, inicioDetecao);
+    if (semMemoria) {
+        return libertarCoordenadas(nefastos);
+    }
+
+    return nefastos;
+    
+ }
+
+/**
+ * @brief Testa os pares cuja primeira antena está em [inicio, fim) e marca os pontos médios.
+ *
+ * @param inicio Primeira posição no vetor agrupado.
+ * @param fim Posição a seguir à última.
+ * @param arg Estado partilhado (EstadoNefastos).
+ */
+
+static void detetarIntervalo(int inicio, int fim, void *arg) {
+
+    EstadoNefastos *e = (EstadoNefastos *)arg;
+
+    for (int i = inicio; i < fim; i++) {
+
+        Antena *a1 = e -> antenas[i];
 
-            if (a1 -> frequencia != a2 -> frequencia) continue;
+        for (int j = i + 1; j < e -> fimGrupo[i]; j++) {
 
+            Antena *a2 = e -> antenas[j];
             int dx = a2 -> x - a1 -> x;
             int dy = a2 -> y - a1 -> y;
 
-            // a2 está o dobro da distância de a1
-            if(dx % 2 == 0 && dy % 2 == 0) {
-                int mx = a1 -> x + dx / 2;
-                int my = a1 -> y + dy / 2;
-                nefastos = adicionarPosicao(nefastos, mx, my);
+            if (dx % 2 == 0 && dy % 2 == 0) {
+                long long celula = (long long)(a1 -> x + dx / 2 - e -> minX) * e -> largura + (a1 -> y + dy / 2 - e -> minY);
+                atomic_fetch_or_explicit(&e -> marcados[celula >> 6], (uint64_t)1 << (celula & 63), memory_order_relaxed);
+            }
+
+        }
+
+    }
+
+}
+
+/**
+ * @brief Deteta os locais nefastos repartindo os pares de antenas pelo conjunto de threads.
+ *
+ * As antenas são agrupadas por frequência e cada tarefa trata um bloco de antenas de
+ * partida. Os pontos médios são marcados num mapa de bits do retângulo que contém as
+ * antenas, o que dispensa a verificação de duplicados da lista. Devolve o mesmo conjunto
+ * que `detectarLocaisNefastos`, ordenado por (x, y).
+ *
+ * @param lista Lista ligada de antenas.
+ * @param pool Conjunto de threads (NULL executa na thread atual).
+ * @return Lista de coordenadas com efeito nefasto, ou NULL se não houver nenhuma ou faltar memória.
+ */
 
+Coordenada *detectarLocaisNefastosParalelo(Antena *lista, PoolTarefas *pool) {
+
+    if (!lista) {
+        return NULL;
+    }
+
+    int n = 0;
+    int minX = lista -> x, maxX = lista -> x, minY = lista -> y, maxY = lista -> y;
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+        n++;
+        if (a -> x < minX) minX = a -> x;
+        if (a -> x > maxX) maxX = a -> x;
+        if (a -> y < minY) minY = a -> y;
+        if (a -> y > maxY) maxY = a -> y;
+    }
+
+    long long largura = (long long)maxY - minY + 1;
+    long long area = ((long long)maxX - minX + 1) * largura;
+    if (area > LIMITE_CELULAS_PARALELO) {
+        // Retângulo demasiado grande para o mapa de bits
+        return detectarLocaisNefastos(lista);
+    }
+
+    EstadoNefastos e;
+    e.antenas = (Antena **)malloc(n * sizeof(Antena *));
+    e.fimGrupo = (int *)malloc(n * sizeof(int));
+    e.marcados = (_Atomic uint64_t *)calloc((size_t)((area + 63) / 64), sizeof(uint64_t));
+    e.minX = minX;
+    e.minY = minY;
+    e.largura = largura;
+
+    if (!e.antenas || !e.fimGrupo || !e.marcados) {
+        free(e.antenas);
+        free(e.fimGrupo);
+        free((void *)e.marcados);
+        return detectarLocaisNefastos(lista);
+    }
+
+    int *inicio = agruparPorFrequencia(lista, e.antenas, e.fimGrupo);
+    if (!inicio) {
+        free(e.antenas);
+        free(e.fimGrupo);
+        free((void *)e.marcados);
+        return detectarLocaisNefastos(lista);
+    }
+    free(inicio);
+
+    paraleloPara(pool, 0, n, GRAO_NEFASTOS, detetarIntervalo, &e);
+
+    // Percorre as células de trás para a frente para a lista ficar por ordem crescente
+    Coordenada *nefastos = NULL;
+    bool semMemoria = false;
+    for (long long p = (area + 63) / 64 - 1; p >= 0 && !semMemoria; p--) {
+
+        uint64_t bits = e.marcados[p];
+
+        while (bits) {
+
+            int b = 63 - __builtin_clzll(bits);
+            bits &= ~((uint64_t)1 << b);
+
+            long long celula = p * 64 + b;
+            Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+            if (!nova) {
+                semMemoria = true;
+                break;
             }
+            INSTR_CONTAR(CONTADOR_ALOC_COORDENADA, 1);
+
+            nova -> x = (int)(celula / largura) + minX;
+            nova -> y = (int)(celula % largura) + minY;
+            nova -> proximo = nefastos;
+            nefastos = nova;
+
         }
+
+    }
+
+    free(e.antenas);
+    free(e.fimGrupo);
+    free((void *)e.marcados);
+
+    if (semMemoria) {
+        return libertarCoordenadas(nefastos);
     }
 
     return nefastos;
-    
- }
\ No newline at end of file
+
+}
+
+/**
+ * @brief Máximo divisor comum de dois valores não negativos.
+ *
+ * @param a Primeiro valor.
+ * @param b Segundo valor.
+ * @return mdc(a, b).
+ */
+
+static int mdc(int a, int b) {
+
+    while (b) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return a;
+
+}
+
+/**
+ * @brief Posição inicial de uma reta na tabela de dispersão.
+ *
+ * @param r Reta.
+ * @param capacidade Tamanho da tabela (potência de 2).
+ * @return Posição na tabela.
+ */
+
+static int dispersaoReta(const Reta *r, int capacidade) {
+
+    uint64_t h = (uint64_t)r -> c * 0x9E3779B97F4A7C15ULL;
+    h ^= ((uint64_t)(uint32_t)r -> sx << 32 | (uint32_t)r -> sy) * 0xBF58476D1CE4E5B9ULL;
+
+    return (int)((h >> 29) & (uint64_t)(capacidade - 1));
+
+}
+
+/**
+ * @brief Insere uma reta no conjunto, se ainda não estiver lá.
+ *
+ * @param t Tabela de retas.
+ * @param r Reta a inserir.
+ * @return 1 se a reta era nova, 0 se já estava marcada, -1 em caso de falha de memória.
+ */
+
+static int inserirReta(TabelaRetas *t, Reta r) {
+
+    if (2 * (t -> ocupadas + 1) > t -> capacidade) {
+
+        // Duplica a tabela e volta a inserir as retas existentes
+        int capacidade = t -> capacidade * 2;
+        Reta *entradas = (Reta *)calloc(capacidade, sizeof(Reta));
+        if (!entradas) {
+            return -1;
+        }
+
+        for (int i = 0; i < t -> capacidade; i++) {
+            if (!t -> entradas[i].usada) continue;
+            int p = dispersaoReta(&t -> entradas[i], capacidade);
+            while (entradas[p].usada) p = (p + 1) & (capacidade - 1);
+            entradas[p] = t -> entradas[i];
+        }
+
+        free(t -> entradas);
+        t -> entradas = entradas;
+        t -> capacidade = capacidade;
+
+    }
+
+    int p = dispersaoReta(&r, t -> capacidade);
+    while (t -> entradas[p].usada) {
+        Reta *e = &t -> entradas[p];
+        if (e -> sx == r.sx && e -> sy == r.sy && e -> c == r.c) return 0;
+        p = (p + 1) & (t -> capacidade - 1);
+    }
+
+    r.usada = true;
+    t -> entradas[p] = r;
+    t -> ocupadas++;
+
+    return 1;
+
+}
+
+/**
+ * @brief Menor inteiro t tal que base + t * passo >= 0, ou maior tal que <= limite.
+ *
+ * Calcula o intervalo [tMin, tMax] de parâmetros em que base + t * passo fica em [0, limite).
+ *
+ * @param base Valor em t = 0.
+ * @param passo Incremento por unidade de t.
+ * @param limite Limite exclusivo.
+ * @param tMin Limite inferior a restringir.
+ * @param tMax Limite superior a restringir.
+ */
+
+static void restringirParametro(long long base, long long passo, long long limite, long long *tMin, long long *tMax) {
+
+    if (passo == 0) {
+        if (base < 0 || base >= limite) *tMax = *tMin - 1; // Reta inteiramente fora do mapa
+        return;
+    }
+
+    // base + t * passo em [0, limite - 1]
+    long long a = -base, b = limite - 1 - base;
+    if (passo < 0) {
+        long long t = a;
+        a = -b;
+        b = -t;
+        passo = -passo;
+    }
+
+    // t >= ceil(a / passo) e t <= floor(b / passo)
+    long long inferior = a >= 0 ? (a + passo - 1) / passo : -((-a) / passo);
+    long long superior = b >= 0 ? b / passo : -((-b + passo - 1) / passo);
+
+    if (inferior > *tMin) *tMin = inferior;
+    if (superior < *tMax) *tMax = superior;
+
+}
+
+/**
+ * @brief Deteta os locais nefastos no modo colinear.
+ *
+ * Para cada par de antenas da mesma frequência, marca num mapa de bits todas as
+ * células do mapa sobre a reta que passa pelas duas, avançando em passos de
+ * (dx / g, dy / g), com g = mdc(|dx|, |dy|). Cada reta é identificada pelo passo
+ * normalizado e pela constante sy * x - sx * y; as retas já marcadas por outro par
+ * (de qualquer frequência) são ignoradas, pelo que o custo é O(k² + retas x largura).
+ *
+ * @param lista Lista ligada de antenas.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @return Lista de coordenadas ordenada por (x, y), ou NULL se não houver nenhuma ou faltar memória.
+ */
+
+Coordenada *detectarLocaisColineares(Antena *lista, int linhas, int colunas) {
+
+    if (!lista || linhas <= 0 || colunas <= 0) {
+        return NULL;
+    }
+
+    int n = 0;
+    for (Antena *a = lista; a; a = a -> proximo) n++;
+
+    long long area = (long long)linhas * colunas;
+    Antena **grupos = (Antena **)malloc(n * sizeof(Antena *));
+    uint64_t *marcados = (uint64_t *)calloc((size_t)((area + 63) / 64), sizeof(uint64_t));
+    TabelaRetas retas = { (Reta *)calloc(CAPACIDADE_RETAS, sizeof(Reta)), CAPACIDADE_RETAS, 0 };
+
+    if (!grupos || !marcados || !retas.entradas) {
+        free(grupos);
+        free(marcados);
+        free(retas.entradas);
+        return NULL;
+    }
+
+    int *contagem = agruparPorFrequencia(lista, grupos, NULL);
+    if (!contagem) {
+        free(grupos);
+        free(marcados);
+        free(retas.entradas);
+        return NULL;
+    }
+
+    bool semMemoria = false;
+    int nf = numFrequencias();
+    for (int f = 0; f < nf && !semMemoria; f++) {
+        for (int i = contagem[f]; i < contagem[f + 1] && !semMemoria; i++) {
+            for (int j = i + 1; j < contagem[f + 1]; j++) {
+
+                Antena *a1 = grupos[i], *a2 = grupos[j];
+                int dx = a2 -> x - a1 -> x;
+                int dy = a2 -> y - a1 -> y;
+                int g = mdc(dx < 0 ? -dx : dx, dy < 0 ? -dy : dy);
+                if (g == 0) continue;
+
+                // Passo primitivo, com sentido normalizado para a mesma reta ter a mesma chave
+                Reta r;
+                r.sx = dx / g;
+                r.sy = dy / g;
+                if (r.sx < 0 || (r.sx == 0 && r.sy < 0)) {
+                    r.sx = -r.sx;
+                    r.sy = -r.sy;
+                }
+                r.c = (long long)r.sy * a1 -> x - (long long)r.sx * a1 -> y;
+                r.usada = false;
+
+                int nova = inserirReta(&retas, r);
+                if (nova < 0) {
+                    semMemoria = true;
+                    break;
+                }
+                if (nova == 0) continue;
+
+                long long tMin = -area - 1, tMax = area + 1;
+                restringirParametro(a1 -> x, r.sx, linhas, &tMin, &tMax);
+                restringirParametro(a1 -> y, r.sy, colunas, &tMin, &tMax);
+
+                for (long long t = tMin; t <= tMax; t++) {
+                    long long celula = (a1 -> x + t * r.sx) * colunas + (a1 -> y + t * r.sy);
+                    marcados[celula >> 6] |= (uint64_t)1 << (celula & 63);
+                }
+
+            }
+        }
+    }
+
+    // Percorre as células de trás para a frente para a lista ficar por ordem crescente
+    Coordenada *locais = NULL;
+    for (long long p = (area + 63) / 64 - 1; p >= 0 && !semMemoria; p--) {
+
+        uint64_t bits = marcados[p];
+
+        while (bits) {
+
+            int b = 63 - __builtin_clzll(bits);
+            bits &= ~((uint64_t)1 << b);
+
+            long long celula = p * 64 + b;
+            Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+            if (!nova) {
+                semMemoria = true;
+                break;
+            }
+            INSTR_CONTAR(CONTADOR_ALOC_COORDENADA, 1);
+
+            nova -> x = (int)(celula / colunas);
+            nova -> y = (int)(celula % colunas);
+            nova -> proximo = locais;
+            locais = nova;
+
+        }
+
+    }
+
+    free(contagem);
+    free(grupos);
+    free(marcados);
+    free(retas.entradas);
+
+    if (semMemoria) {
+        return libertarCoordenadas(locais);
+    }
+
+    return locais;
+
+}
@@ -12,13 +12,18 @@
  *
  * Um local tem efeito nefasto quando está perfeitamente alinhado com duas antenas
  * da mesma frequência e uma delas está exatamente o dobro da distância da outra.
+ * No modo colinear ("ressonante"), todas as células do mapa sobre a reta que passa
+ * por duas antenas da mesma frequência são nefastas.
  */
 
 #ifndef NEFASTOS_H
 #define NEFASTOS_H
 
 #include "antenas.h"
+#include "tarefas.h"
 
 Coordenada *detectarLocaisNefastos(Antena *lista);
+Coordenada *detectarLocaisNefastosParalelo(Antena *lista, PoolTarefas *pool);
+Coordenada *detectarLocaisColineares(Antena *lista, int linhas, int colunas);
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
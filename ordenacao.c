@@ -0,0 +1,248 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file ordenacao.c
+ * @author Thiago Abreu
+ * @brief Implementação da ordenação radix LSD de 8 bits por passagem.
+ *
+ * Os histogramas das 8 passagens são calculados numa só leitura e as passagens em
+ * que todas as chaves têm o mesmo byte são saltadas; em mapas pequenos os bytes
+ * altos das coordenadas são constantes, pelo que só restam 2 a 4 passagens.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "ordenacao.h"
+
+/** Número de passagens de 8 bits numa chave de 64 bits. */
+#define PASSAGENS_RADIX 8
+
+/**
+ * @struct EntradaOrdenacao
+ * @brief Nó (ou par de nós) de uma lista, com as chaves de ordenação.
+ */
+
+typedef struct EntradaOrdenacao {
+    uint64_t chave[2];     /**< Chaves: a da primeira coordenada e a da segunda (pares) */
+    Coordenada *no;        /**< Primeiro nó da entrada */
+} EntradaOrdenacao;
+
+/**
+ * @brief Codifica (x, y) numa chave cuja ordem sem sinal é a ordem (x, y) com sinal.
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Chave de 64 bits.
+ */
+
+uint64_t chaveCoordenada(int x, int y) {
+
+    return ((uint64_t)((uint32_t)x ^ 0x80000000u) << 32) | ((uint32_t)y ^ 0x80000000u);
+
+}
+
+/**
+ * @brief Ordena um vetor de chaves de 64 bits por ordem crescente.
+ *
+ * @param chaves Vetor de chaves.
+ * @param n Número de chaves.
+ * @return true se o vetor ficou ordenado, false em caso de falha de memória (vetor inalterado).
+ */
+
+bool ordenarChaves(uint64_t *chaves, long n) {
+
+    if (n < 2) {
+        return true;
+    }
+
+    uint64_t *auxiliar = (uint64_t *)malloc(n * sizeof(uint64_t));
+    long (*contagem)[256] = calloc(PASSAGENS_RADIX, sizeof(*contagem));
+    if (!auxiliar || !contagem) {
+        free(auxiliar);
+        free(contagem);
+        return false;
+    }
+
+    for (long i = 0; i < n; i++) {
+        for (int p = 0; p < PASSAGENS_RADIX; p++) contagem[p][(chaves[i] >> (8 * p)) & 255]++;
+    }
+
+    uint64_t *origem = chaves, *destino = auxiliar;
+    for (int p = 0; p < PASSAGENS_RADIX; p++) {
+
+        // Byte igual em todas as chaves: a passagem não mudaria nada
+        if (contagem[p][(origem[0] >> (8 * p)) & 255] == n) continue;
+
+        long posicao = 0;
+        for (int b = 0; b < 256; b++) {
+            long c = contagem[p][b];
+            contagem[p][b] = posicao;
+            posicao += c;
+        }
+
+        for (long i = 0; i < n; i++) {
+            destino[contagem[p][(origem[i] >> (8 * p)) & 255]++] = origem[i];
+        }
+
+        uint64_t *t = origem;
+        origem = destino;
+        destino = t;
+
+    }
+
+    if (origem != chaves) {
+        memcpy(chaves, origem, n * sizeof(uint64_t));
+    }
+
+    free(auxiliar);
+    free(contagem);
+
+    return true;
+
+}
+
+/**
+ * @brief Ordena entradas de forma estável por uma das chaves.
+ *
+ * @param v Entradas (ficam ordenadas no mesmo vetor).
+ * @param auxiliar Vetor de trabalho com n entradas.
+ * @param n Número de entradas.
+ * @param campo Chave usada (0 ou 1).
+ * @return true se ordenou, false em caso de falha de memória (vetor inalterado).
+ */
+
+static bool ordenarEntradas(EntradaOrdenacao *v, EntradaOrdenacao *auxiliar, long n, int campo) {
+
+    long (*contagem)[256] = calloc(PASSAGENS_RADIX, sizeof(*contagem));
+    if (!contagem) {
+        return false;
+    }
+
+    for (long i = 0; i < n; i++) {
+        for (int p = 0; p < PASSAGENS_RADIX; p++) contagem[p][(v[i].chave[campo] >> (8 * p)) & 255]++;
+    }
+
+    EntradaOrdenacao *origem = v, *destino = auxiliar;
+    for (int p = 0; p < PASSAGENS_RADIX; p++) {
+
+        if (contagem[p][(origem[0].chave[campo] >> (8 * p)) & 255] == n) continue;
+
+        long posicao = 0;
+        for (int b = 0; b < 256; b++) {
+            long c = contagem[p][b];
+            contagem[p][b] = posicao;
+            posicao += c;
+        }
+
+        for (long i = 0; i < n; i++) {
+            destino[contagem[p][(origem[i].chave[campo] >> (8 * p)) & 255]++] = origem[i];
+        }
+
+        EntradaOrdenacao *t = origem;
+        origem = destino;
+        destino = t;
+
+    }
+
+    if (origem != v) {
+        memcpy(v, origem, n * sizeof(EntradaOrdenacao));
+    }
+
+    free(contagem);
+
+    return true;
+
+}
+
+/**
+ * @brief Ordena por (x, y) os nós, ou os pares de nós consecutivos, de uma lista.
+ *
+ * @param lista Lista de coordenadas.
+ * @param tamanhoEntrada 1 para nós isolados, 2 para pares.
+ * @return Nova cabeça da lista (a lista original se faltar memória).
+ */
+
+static Coordenada *ordenarLista(Coordenada *lista, int tamanhoEntrada) {
+
+    long nos = 0;
+    for (Coordenada *c = lista; c; c = c -> proximo) nos++;
+
+    // Num número ímpar de nós em pares, o último fica no fim
+    long n = nos / tamanhoEntrada;
+    if (n < 2) {
+        return lista;
+    }
+
+    EntradaOrdenacao *entradas = (EntradaOrdenacao *)malloc(2 * n * sizeof(EntradaOrdenacao));
+    if (!entradas) {
+        return lista;
+    }
+
+    Coordenada *c = lista;
+    for (long i = 0; i < n; i++) {
+        entradas[i].no = c;
+        entradas[i].chave[0] = chaveCoordenada(c -> x, c -> y);
+        c = c -> proximo;
+        if (tamanhoEntrada == 2) {
+            entradas[i].chave[1] = chaveCoordenada(c -> x, c -> y);
+            c = c -> proximo;
+        }
+    }
+    Coordenada *resto = c;
+
+    // LSD: primeiro pela chave menos significativa (a segunda coordenada do par)
+    bool ordenado = (tamanhoEntrada == 1 || ordenarEntradas(entradas, entradas + n, n, 1)) &&
+                    ordenarEntradas(entradas, entradas + n, n, 0);
+    if (!ordenado) {
+        free(entradas);
+        return lista;
+    }
+
+    // Volta a ligar os nós pela nova ordem, mantendo cada par junto
+    for (long i = 0; i < n; i++) {
+        Coordenada *ultimo = entradas[i].no;
+        if (tamanhoEntrada == 2) ultimo = ultimo -> proximo;
+        ultimo -> proximo = i + 1 < n ? entradas[i + 1].no : resto;
+    }
+    lista = entradas[0].no;
+
+    free(entradas);
+
+    return lista;
+
+}
+
+/**
+ * @brief Ordena uma lista de coordenadas por (x, y), reaproveitando os nós.
+ *
+ * A ordenação é estável: posições repetidas mantêm a ordem relativa.
+ *
+ * @param lista Lista de coordenadas.
+ * @return Nova cabeça da lista (a lista original, por ordenar, se faltar memória).
+ */
+
+Coordenada *ordenarCoordenadas(Coordenada *lista) {
+
+    return ordenarLista(lista, 1);
+
+}
+
+/**
+ * @brief Ordena uma lista de pares (nós consecutivos, como em `intersecoesFrequencias`).
+ *
+ * Os pares são ordenados pela primeira coordenada e, em caso de empate, pela segunda.
+ *
+ * @param lista Lista de pares de coordenadas.
+ * @return Nova cabeça da lista (a lista original, por ordenar, se faltar memória).
+ */
+
+Coordenada *ordenarParesCoordenadas(Coordenada *lista) {
+
+    return ordenarLista(lista, 2);
+
+}
@@ -0,0 +1,31 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file ordenacao.h
+ * @author Thiago Abreu
+ * @brief Ordenação em tempo linear (radix LSD) de chaves e de listas de coordenadas.
+ *
+ * As listas produzidas por `adicionarPosicao` saem pela ordem inversa de inserção,
+ * que depende da disposição da lista e das arestas. Estas funções reordenam os nós
+ * por (x, y) sem os copiar, para que a saída das consultas seja determinística.
+ */
+
+#ifndef ORDENACAO_H
+#define ORDENACAO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "antenas.h"
+
+uint64_t chaveCoordenada(int x, int y);
+bool ordenarChaves(uint64_t *chaves, long n);
+Coordenada *ordenarCoordenadas(Coordenada *lista);
+Coordenada *ordenarParesCoordenadas(Coordenada *lista);
+
+#endif
@@ -0,0 +1,683 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file procuras.c
+ * @author Thiago Abreu
+ * @brief Implementação das procuras sobre o grafo compacto.
+ *
+ * A procura em lote (MS-BFS) associa a cada vértice três máscaras de 64 bits:
+ * origens que já o visitaram, origens cuja fronteira o contém e origens que o
+ * alcançam no próximo nível. Um bit corresponde a uma origem do lote, por isso
+ * 64 procuras avançam com as mesmas operações sobre as arestas.
+ *
+ * A procura paralela alterna entre expansão descendente (a fronteira procura
+ * vizinhos por visitar) e ascendente (cada vértice por visitar procura um pai na
+ * fronteira), conforme o tamanho da fronteira, com cada nível repartido pelo
+ * conjunto de threads partilhado.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "procuras.h"
+#include "funcoes.h"
+
+/** Passa a ascendente quando os arcos da fronteira excedem os arcos por explorar / ALFA. */
+#define ALFA_DIRECAO 14
+
+/** Volta a descendente quando a fronteira tem menos de numVertices / BETA vértices. */
+#define BETA_DIRECAO 24
+
+/** Tamanho do tampão local de cada tarefa antes de publicar na fronteira seguinte. */
+#define TAMPAO_FRONTEIRA 256
+
+/** Vértices da fronteira por tarefa no modo descendente. */
+#define GRAO_FRONTEIRA 1024
+
+/** Palavras do mapa de bits por tarefa no modo ascendente. */
+#define GRAO_PALAVRAS 64
+
+/**
+ * @brief Executa uma travessia em lote para até 64 origens consecutivas.
+ *
+ * @param g Grafo compacto.
+ * @param d Tabela de distâncias a preencher.
+ * @param primeira Índice (em `d->origens`) da primeira origem do lote.
+ * @param quantas Número de origens do lote (no máximo ORIGENS_POR_LOTE).
+ * @param visto Máscaras de origens que já visitaram cada vértice.
+ * @param frente Máscaras da fronteira atual.
+ * @param seguinte Máscaras da fronteira do próximo nível.
+ */
+
+static void percorrerLote(const GrafoCSR *g, DistanciasLargura *d, int primeira, int quantas,
+                          uint64_t *visto, uint64_t *frente, uint64_t *seguinte) {
+
+    int n = g -> numVertices;
+    memset(visto, 0, n * sizeof(uint64_t));
+    memset(frente, 0, n * sizeof(uint64_t));
+    memset(seguinte, 0, n * sizeof(uint64_t));
+
+    bool ativa = false;
+    for (int i = 0; i < quantas; i++) {
+
+        int s = d -> origens[primeira + i];
+        if (s < 0) continue;
+
+        uint64_t bit = (uint64_t)1 << i;
+        visto[s] |= bit;
+        frente[s] |= bit;
+        d -> distancias[(size_t)(primeira + i) * n + s] = 0;
+        ativa = true;
+
+    }
+
+    int nivel = 0;
+    while (ativa) {
+
+        nivel++;
+
+        // Propaga a fronteira de cada vértice para os vizinhos
+        for (int v = 0; v < n; v++) {
+
+            uint64_t f = frente[v];
+            if (!f) continue;
+
+            for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+                seguinte[g -> destinos[k]] |= f;
+            }
+
+        }
+
+        // Mantém apenas as origens que chegam pela primeira vez a cada vértice
+        ativa = false;
+        for (int v = 0; v < n; v++) {
+
+            uint64_t novos = seguinte[v] & ~visto[v];
+            seguinte[v] = 0;
+            frente[v] = novos;
+
+            if (!novos) continue;
+
+            visto[v] |= novos;
+            ativa = true;
+
+            while (novos) {
+                int i = __builtin_ctzll(novos);
+                d -> distancias[(size_t)(primeira + i) * n + v] = nivel;
+                novos &= novos - 1;
+            }
+
+        }
+
+    }
+
+}
+
+/**
+ * @brief Calcula as distâncias em saltos de várias origens para todos os vértices.
+ *
+ * As origens são processadas em lotes de ORIGENS_POR_LOTE, cada lote com uma única
+ * travessia do grafo. Origens com índice negativo ficam com todas as distâncias a -1.
+ *
+ * @param g Grafo compacto.
+ * @param origens Vetor com os índices CSR das origens.
+ * @param numOrigens Número de origens.
+ * @return Tabela de distâncias, ou false em caso de erro.
+ */
+
+DistanciasLargura *procuraLarguraMultipla(const GrafoCSR *g, const int *origens, int numOrigens) {
+
+    if (!g || numOrigens < 0 || (numOrigens > 0 && !origens)) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    DistanciasLargura *d = (DistanciasLargura *)calloc(1, sizeof(DistanciasLargura));
+    if (!d) {
+        return false;
+    }
+
+    d -> numOrigens = numOrigens;
+    d -> numVertices = n;
+    d -> origens = (int *)malloc((numOrigens > 0 ? numOrigens : 1) * sizeof(int));
+    d -> distancias = (int *)malloc(((size_t)numOrigens * n > 0 ? (size_t)numOrigens * n : 1) * sizeof(int));
+
+    uint64_t *visto = (uint64_t *)malloc((n > 0 ? n : 1) * sizeof(uint64_t));
+    uint64_t *frente = (uint64_t *)malloc((n > 0 ? n : 1) * sizeof(uint64_t));
+    uint64_t *seguinte = (uint64_t *)malloc((n > 0 ? n : 1) * sizeof(uint64_t));
+
+    if (!d -> origens || !d -> distancias || !visto || !frente || !seguinte) {
+        free(visto);
+        free(frente);
+        free(seguinte);
+        return libertarDistanciasLargura(d);
+    }
+
+    for (int i = 0; i < numOrigens; i++) {
+        d -> origens[i] = (origens[i] >= 0 && origens[i] < n) ? origens[i] : -1;
+    }
+
+    for (size_t i = 0; i < (size_t)numOrigens * n; i++) {
+        d -> distancias[i] = -1;
+    }
+
+    for (int primeira = 0; primeira < numOrigens; primeira += ORIGENS_POR_LOTE) {
+
+        int quantas = numOrigens - primeira;
+        if (quantas > ORIGENS_POR_LOTE) quantas = ORIGENS_POR_LOTE;
+        percorrerLote(g, d, primeira, quantas, visto, frente, seguinte);
+
+    }
+
+    free(visto);
+    free(frente);
+    free(seguinte);
+
+    return d;
+
+}
+
+/**
+ * @brief Calcula a tabela de cobertura de todas as antenas de uma frequência.
+ *
+ * Equivale a chamar `procuraLargura` a partir de cada antena da frequência,
+ * mas com uma travessia por cada lote de 64 antenas.
+ *
+ * @param g Grafo compacto.
+ * @param frequencia Frequência das antenas de origem.
+ * @return Tabela de distâncias com uma origem por antena da frequência, ou false em caso de erro.
+ */
+
+DistanciasLargura *procuraLarguraFrequencia(const GrafoCSR *g, Frequencia frequencia) {
+
+    if (!g) {
+        return false;
+    }
+
+    int total = 0;
+    for (int v = 0; v < g -> numVertices; v++) {
+        if (g -> frequencia[v] == frequencia) total++;
+    }
+
+    int *origens = (int *)malloc((total > 0 ? total : 1) * sizeof(int));
+    if (!origens) {
+        return false;
+    }
+
+    int k = 0;
+    for (int v = 0; v < g -> numVertices; v++) {
+        if (g -> frequencia[v] == frequencia) origens[k++] = v;
+    }
+
+    DistanciasLargura *d = procuraLarguraMultipla(g, origens, total);
+    free(origens);
+
+    return d;
+
+}
+
+/**
+ * @struct EstadoLarguraParalela
+ * @brief Estado partilhado pelas tarefas da procura em largura paralela.
+ */
+
+typedef struct EstadoLarguraParalela {
+    const GrafoCSR *g;                  /**< Grafo percorrido */
+    int numPalavras;                    /**< Palavras de 64 bits dos mapas de bits */
+    _Atomic uint64_t *visitados;        /**< Mapa de bits dos vértices visitados */
+    uint64_t *frenteBits;               /**< Fronteira atual em mapa de bits (modo ascendente) */
+    uint64_t *seguinteBits;             /**< Fronteira seguinte em mapa de bits (modo ascendente) */
+    int *frente;                        /**< Fronteira atual em vetor (modo descendente) */
+    int *seguinte;                      /**< Fronteira seguinte em vetor (modo descendente) */
+    int numFrente;                      /**< Número de vértices da fronteira atual */
+    _Atomic int numSeguinte;            /**< Número de vértices da fronteira seguinte */
+    _Atomic long long arcosSeguinte;    /**< Soma dos graus da fronteira seguinte */
+    int *distancias;                    /**< Distância de cada vértice à origem */
+    int nivel;                          /**< Nível a ser expandido */
+    bool ascendente;                    /**< true se o nível é expandido de baixo para cima */
+} EstadoLarguraParalela;
+
+/**
+ * @brief Expande uma parte da fronteira descendente.
+ *
+ * Cada vizinho por visitar é reclamado com uma operação atómica sobre o mapa de bits,
+ * pelo que só uma tarefa o acrescenta à fronteira seguinte.
+ *
+ * @param inicio Primeira posição da fronteira a expandir.
+ * @param fim Posição a seguir à última.
+ * @param arg Estado partilhado (EstadoLarguraParalela).
+ */
+
+static void expandirDescendente(int inicio, int fim, void *arg) {
+
+    EstadoLarguraParalela *e = (EstadoLarguraParalela *)arg;
+    const GrafoCSR *g = e -> g;
+
+    int tampao[TAMPAO_FRONTEIRA];
+    int usados = 0;
+    long long arcos = 0;
+
+    for (int i = inicio; i < fim; i++) {
+
+        int v = e -> frente[i];
+
+        for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+
+            int w = g -> destinos[k];
+            uint64_t bit = (uint64_t)1 << (w & 63);
+
+            if (atomic_load_explicit(&e -> visitados[w >> 6], memory_order_relaxed) & bit) continue;
+            if (atomic_fetch_or_explicit(&e -> visitados[w >> 6], bit, memory_order_relaxed) & bit) continue;
+
+            e -> distancias[w] = e -> nivel;
+            arcos += g -> inicioArestas[w + 1] - g -> inicioArestas[w];
+            tampao[usados++] = w;
+
+            if (usados == TAMPAO_FRONTEIRA) {
+                int pos = atomic_fetch_add(&e -> numSeguinte, usados);
+                memcpy(e -> seguinte + pos, tampao, usados * sizeof(int));
+                usados = 0;
+            }
+
+        }
+
+    }
+
+    if (usados > 0) {
+        int pos = atomic_fetch_add(&e -> numSeguinte, usados);
+        memcpy(e -> seguinte + pos, tampao, usados * sizeof(int));
+    }
+
+    atomic_fetch_add(&e -> arcosSeguinte, arcos);
+
+}
+
+/**
+ * @brief Expande de baixo para cima uma parte das palavras do mapa de bits.
+ *
+ * Cada vértice por visitar procura um vizinho na fronteira e pára no primeiro que
+ * encontrar. Como as tarefas trabalham em palavras disjuntas, a escrita na fronteira
+ * seguinte não precisa de sincronização.
+ *
+ * @param inicio Primeira palavra do mapa de bits.
+ * @param fim Palavra a seguir à última.
+ * @param arg Estado partilhado (EstadoLarguraParalela).
+ */
+
+static void expandirAscendente(int inicio, int fim, void *arg) {
+
+    EstadoLarguraParalela *e = (EstadoLarguraParalela *)arg;
+    const GrafoCSR *g = e -> g;
+    int n = g -> numVertices;
+
+    int novos = 0;
+    long long arcos = 0;
+
+    for (int p = inicio; p < fim; p++) {
+
+        uint64_t porVisitar = ~atomic_load_explicit(&e -> visitados[p], memory_order_relaxed);
+        uint64_t encontrados = 0;
+
+        while (porVisitar) {
+
+            int b = __builtin_ctzll(porVisitar);
+            porVisitar &= porVisitar - 1;
+
+            int v = p * 64 + b;
+            if (v >= n) break;
+
+            for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+
+                int w = g -> destinos[k];
+                if (e -> frenteBits[w >> 6] & ((uint64_t)1 << (w & 63))) {
+                    encontrados |= (uint64_t)1 << b;
+                    e -> distancias[v] = e -> nivel;
+                    arcos += g -> inicioArestas[v + 1] - g -> inicioArestas[v];
+                    novos++;
+                    break;
+                }
+
+            }
+
+        }
+
+        e -> seguinteBits[p] = encontrados;
+        if (encontrados) {
+            atomic_fetch_or_explicit(&e -> visitados[p], encontrados, memory_order_relaxed);
+        }
+
+    }
+
+    atomic_fetch_add(&e -> numSeguinte, novos);
+    atomic_fetch_add(&e -> arcosSeguinte, arcos);
+
+}
+
+/**
+ * @brief Prepara a fronteira do próximo nível e escolhe o sentido de expansão.
+ *
+ * Executada pela thread que conduz a procura, depois de todas as partes do nível terminarem.
+ *
+ * @param e Estado partilhado.
+ * @param arcosPorExplorar Soma dos graus dos vértices ainda não visitados (atualizada).
+ */
+
+static void prepararNivel(EstadoLarguraParalela *e, long long *arcosPorExplorar) {
+
+    int n = e -> g -> numVertices;
+    int numNovos = atomic_load(&e -> numSeguinte);
+    long long arcosNovos = atomic_load(&e -> arcosSeguinte);
+    bool eraAscendente = e -> ascendente;
+
+    *arcosPorExplorar -= arcosNovos;
+
+    bool ascendente = eraAscendente;
+    if (!eraAscendente && arcosNovos > *arcosPorExplorar / ALFA_DIRECAO) {
+        ascendente = true;
+    } else if (eraAscendente && numNovos < n / BETA_DIRECAO) {
+        ascendente = false;
+    }
+
+    if (ascendente) {
+
+        if (eraAscendente) {
+            uint64_t *tmp = e -> frenteBits;
+            e -> frenteBits = e -> seguinteBits;
+            e -> seguinteBits = tmp;
+        } else {
+            memset(e -> frenteBits, 0, e -> numPalavras * sizeof(uint64_t));
+            for (int i = 0; i < numNovos; i++) {
+                int v = e -> seguinte[i];
+                e -> frenteBits[v >> 6] |= (uint64_t)1 << (v & 63);
+            }
+        }
+
+    } else {
+
+        if (eraAscendente) {
+            int k = 0;
+            for (int p = 0; p < e -> numPalavras; p++) {
+                uint64_t bits = e -> seguinteBits[p];
+                while (bits) {
+                    e -> seguinte[k++] = p * 64 + __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        int *tmp = e -> frente;
+        e -> frente = e -> seguinte;
+        e -> seguinte = tmp;
+
+    }
+
+    e -> ascendente = ascendente;
+    e -> numFrente = numNovos;
+    e -> nivel++;
+    atomic_store(&e -> numSeguinte, 0);
+    atomic_store(&e -> arcosSeguinte, 0);
+
+}
+
+/**
+ * @brief Procura em largura paralela com otimização de sentido (top-down / bottom-up).
+ *
+ * Cada nível é repartido pelas threads do conjunto com `paraleloPara`. Enquanto a
+ * fronteira é pequena expande-se de cima para baixo; quando cresce ao ponto de a
+ * maioria dos vizinhos já estar visitada, cada vértice por visitar procura antes um
+ * pai na fronteira. O conjunto alcançado é o mesmo que `procuraLargura` devolve.
+ *
+ * @param g Grafo compacto.
+ * @param origem Índice CSR do vértice de origem.
+ * @param pool Conjunto de threads (NULL executa a procura na thread atual).
+ * @return Tabela de distâncias com uma única origem, ou false em caso de erro.
+ */
+
+DistanciasLargura *procuraLarguraParalela(const GrafoCSR *g, int origem, PoolTarefas *pool) {
+
+    if (!g || origem < 0 || origem >= g -> numVertices) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    DistanciasLargura *d = (DistanciasLargura *)calloc(1, sizeof(DistanciasLargura));
+    if (!d) {
+        return false;
+    }
+
+    d -> numOrigens = 1;
+    d -> numVertices = n;
+    d -> origens = (int *)malloc(sizeof(int));
+    d -> distancias = (int *)malloc(n * sizeof(int));
+
+    EstadoLarguraParalela e;
+    memset(&e, 0, sizeof(e));
+    e.g = g;
+    e.numPalavras = (n + 63) / 64;
+    e.visitados = (_Atomic uint64_t *)calloc(e.numPalavras, sizeof(uint64_t));
+    e.frenteBits = (uint64_t *)calloc(e.numPalavras, sizeof(uint64_t));
+    e.seguinteBits = (uint64_t *)calloc(e.numPalavras, sizeof(uint64_t));
+    e.frente = (int *)malloc(n * sizeof(int));
+    e.seguinte = (int *)malloc(n * sizeof(int));
+
+    if (!d -> origens || !d -> distancias || !e.visitados || !e.frenteBits || !e.seguinteBits ||
+        !e.frente || !e.seguinte) {
+        free((void *)e.visitados);
+        free(e.frenteBits);
+        free(e.seguinteBits);
+        free(e.frente);
+        free(e.seguinte);
+        return libertarDistanciasLargura(d);
+    }
+
+    d -> origens[0] = origem;
+    for (int v = 0; v < n; v++) {
+        d -> distancias[v] = -1;
+    }
+
+    e.distancias = d -> distancias;
+    e.distancias[origem] = 0;
+    e.visitados[origem >> 6] = (uint64_t)1 << (origem & 63);
+    e.frente[0] = origem;
+    e.numFrente = 1;
+    e.nivel = 1;
+
+    long long arcosPorExplorar = g -> numArcos - (g -> inicioArestas[origem + 1] - g -> inicioArestas[origem]);
+
+    while (e.numFrente > 0) {
+
+        if (e.ascendente) {
+            paraleloPara(pool, 0, e.numPalavras, GRAO_PALAVRAS, expandirAscendente, &e);
+        } else {
+            paraleloPara(pool, 0, e.numFrente, GRAO_FRONTEIRA, expandirDescendente, &e);
+        }
+
+        prepararNivel(&e, &arcosPorExplorar);
+
+    }
+
+    free((void *)e.visitados);
+    free(e.frenteBits);
+    free(e.seguinteBits);
+    free(e.frente);
+    free(e.seguinte);
+
+    return d;
+
+}
+
+/**
+ * @brief Procura em profundidade iterativa sobre o grafo compacto.
+ *
+ * Visita os vértices pela mesma ordem que `procuraProfundidade` (as arestas de cada
+ * vértice pela ordem da sua lista) e devolve-os na mesma disposição: a lista começa
+ * pelo último vértice visitado. Usa uma pilha explícita e um mapa de bits em vez de
+ * recursão e listas de visitados.
+ *
+ * @param g Grafo compacto.
+ * @param origem Índice CSR do vértice de partida.
+ * @return Lista de coordenadas alcançadas, ou false se a origem for inválida ou faltar memória.
+ */
+
+Coordenada *procuraProfundidadeCSR(const GrafoCSR *g, int origem) {
+
+    if (!g || origem < 0 || origem >= g -> numVertices) {
+        return false;
+    }
+
+    int n = g -> numVertices;
+    uint64_t *visitados = (uint64_t *)calloc((n + 63) / 64, sizeof(uint64_t));
+    int *pilha = (int *)malloc(n * sizeof(int));
+    int *proxima = (int *)malloc(n * sizeof(int));
+
+    if (!visitados || !pilha || !proxima) {
+        free(visitados);
+        free(pilha);
+        free(proxima);
+        return false;
+    }
+
+    Coordenada *resultado = NULL;
+    bool semMemoria = false;
+    int topo = 0;
+    pilha[0] = origem;
+    proxima[0] = g -> inicioArestas[origem];
+    visitados[origem >> 6] |= (uint64_t)1 << (origem & 63);
+
+    while (topo >= 0) {
+
+        int v = pilha[topo];
+
+        if (proxima[topo] == g -> inicioArestas[v]) {
+            // Primeira vez no topo da pilha: regista a visita
+            Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+            if (!nova) {
+                semMemoria = true;
+                break;
+            }
+            nova -> x = g -> x[v];
+            nova -> y = g -> y[v];
+            nova -> proximo = resultado;
+            resultado = nova;
+        }
+
+        int w = -1;
+        while (proxima[topo] < g -> inicioArestas[v + 1]) {
+            int c = g -> destinos[proxima[topo]++];
+            if (!(visitados[c >> 6] & ((uint64_t)1 << (c & 63)))) {
+                w = c;
+                break;
+            }
+        }
+
+        if (w < 0) {
+            topo--;
+            continue;
+        }
+
+        visitados[w >> 6] |= (uint64_t)1 << (w & 63);
+        topo++;
+        pilha[topo] = w;
+        proxima[topo] = g -> inicioArestas[w];
+
+    }
+
+    free(visitados);
+    free(pilha);
+    free(proxima);
+
+    if (semMemoria) {
+        return libertarCoordenadas(resultado);
+    }
+
+    return resultado;
+
+}
+
+/**
+ * @brief Consulta a distância de uma origem da tabela a um vértice.
+ *
+ * @param d Tabela de distâncias.
+ * @param indiceOrigem Posição da origem na tabela.
+ * @param vertice Índice CSR do vértice.
+ * @return Número de saltos, ou -1 se não for alcançável ou os índices forem inválidos.
+ */
+
+int distanciaLargura(const DistanciasLargura *d, int indiceOrigem, int vertice) {
+
+    if (!d || indiceOrigem < 0 || indiceOrigem >= d -> numOrigens || vertice < 0 || vertice >= d -> numVertices) {
+        return -1;
+    }
+
+    return d -> distancias[(size_t)indiceOrigem * d -> numVertices + vertice];
+
+}
+
+/**
+ * @brief Converte o conjunto alcançado por uma origem numa lista de coordenadas.
+ *
+ * Produz o mesmo conjunto de posições que `procuraLargura` devolveria para essa origem.
+ *
+ * @param d Tabela de distâncias.
+ * @param g Grafo compacto usado na procura.
+ * @param indiceOrigem Posição da origem na tabela.
+ * @return Lista de coordenadas alcançadas, ou false se a origem for inválida ou faltar memória.
+ */
+
+Coordenada *alcancadosLargura(const DistanciasLargura *d, const GrafoCSR *g, int indiceOrigem) {
+
+    if (!d || !g || indiceOrigem < 0 || indiceOrigem >= d -> numOrigens) {
+        return false;
+    }
+
+    Coordenada *resultado = NULL;
+    const int *linha = d -> distancias + (size_t)indiceOrigem * d -> numVertices;
+
+    // Pela ordem (x, y), também nos grafos reordenados
+    for (int p = d -> numVertices - 1; p >= 0; p--) {
+
+        int v = verticeOrdemCoordenadas(g, p);
+        if (linha[v] < 0) continue;
+
+        Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+        if (!nova) {
+            return libertarCoordenadas(resultado);
+        }
+
+        nova -> x = g -> x[v];
+        nova -> y = g -> y[v];
+        nova -> proximo = resultado;
+        resultado = nova;
+
+    }
+
+    return resultado;
+
+}
+
+/**
+ * @brief Liberta a memória de uma tabela de distâncias.
+ *
+ * @param d Tabela de distâncias.
+ * @return false após a libertação completa.
+ */
+
+DistanciasLargura *libertarDistanciasLargura(DistanciasLargura *d) {
+
+    if (!d) {
+        return false;
+    }
+
+    free(d -> origens);
+    free(d -> distancias);
+    free(d);
+
+    return false;
+
+}
@@ -0,0 +1,53 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file procuras.h
+ * @author Thiago Abreu
+ * @brief Procuras em largura e profundidade sobre o grafo compacto (CSR).
+ *
+ * Complementa `procuraLargura` com uma procura em lote que processa até 64 origens
+ * numa só travessia, usando uma máscara de 64 bits por vértice (MS-BFS), e com uma
+ * procura paralela que alterna entre expansão descendente e ascendente.
+ * Inclui ainda uma procura em profundidade iterativa equivalente a `procuraProfundidade`.
+ */
+
+#ifndef PROCURAS_H
+#define PROCURAS_H
+
+#include "antenas.h"
+#include "grafocsr.h"
+#include "tarefas.h"
+
+/** Número de origens tratadas em simultâneo por cada travessia em lote. */
+#define ORIGENS_POR_LOTE 64
+
+/**
+ * @struct DistanciasLargura
+ * @brief Tabela de distâncias (em saltos) de várias origens para todos os vértices.
+ *
+ * A distância da origem `o` ao vértice `v` está em `distancias[o * numVertices + v]`,
+ * valendo -1 quando o vértice não é alcançável.
+ */
+
+typedef struct DistanciasLargura {
+    int numOrigens;     /**< Número de origens */
+    int numVertices;    /**< Número de vértices do grafo */
+    int *origens;       /**< Índice CSR de cada origem */
+    int *distancias;    /**< Matriz numOrigens x numVertices de distâncias */
+} DistanciasLargura;
+
+DistanciasLargura *procuraLarguraMultipla(const GrafoCSR *g, const int *origens, int numOrigens);
+DistanciasLargura *procuraLarguraFrequencia(const GrafoCSR *g, Frequencia frequencia);
+DistanciasLargura *procuraLarguraParalela(const GrafoCSR *g, int origem, PoolTarefas *pool);
+Coordenada *procuraProfundidadeCSR(const GrafoCSR *g, int origem);
+int distanciaLargura(const DistanciasLargura *d, int indiceOrigem, int vertice);
+Coordenada *alcancadosLargura(const DistanciasLargura *d, const GrafoCSR *g, int indiceOrigem);
+DistanciasLargura *libertarDistanciasLargura(DistanciasLargura *d);
+
+#endif
@@ -0,0 +1,377 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file regiao.c
+ * @author Thiago Abreu
+ * @brief Implementação do índice de regiões em grelha de baldes.
+ *
+ * O lado dos baldes é escolhido para que, em média, cada um tenha cerca de
+ * ANTENAS_POR_BALDE antenas. Uma consulta de área A custa O(A / lado² + antenas
+ * dos baldes da fronteira + resultado).
+ */
+
+#include <stdlib.h>
+#include "regiao.h"
+#include "funcoes.h"
+
+/**
+ * @brief Balde onde fica uma antena (as de fora do mapa vão para a margem).
+ *
+ * @param ind Índice.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @param fora Indica se a antena está fora do mapa (pode ser NULL).
+ * @return Índice do balde.
+ */
+
+static int baldeDe(const IndiceRegioes *ind, int x, int y, bool *fora) {
+
+    int bx = x < 0 ? 0 : x / ind -> lado;
+    int by = y < 0 ? 0 : y / ind -> lado;
+
+    if (bx >= ind -> baldesX) bx = ind -> baldesX - 1;
+    if (by >= ind -> baldesY) by = ind -> baldesY - 1;
+
+    if (fora) {
+        *fora = x < 0 || y < 0 || x >= ind -> linhas || y >= ind -> colunas;
+    }
+
+    return bx * ind -> baldesY + by;
+
+}
+
+/**
+ * @brief Acrescenta uma antena ao seu balde.
+ *
+ * @param ind Índice.
+ * @param frequencia Frequência.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a antena foi guardada, false em caso de falha de memória.
+ */
+
+static bool guardarPonto(IndiceRegioes *ind, Frequencia frequencia, int x, int y) {
+
+    bool fora;
+    BaldeRegiao *b = &ind -> baldes[baldeDe(ind, x, y, &fora)];
+
+    if (b -> numPontos == b -> capacidade) {
+        int capacidade = b -> capacidade ? 2 * b -> capacidade : 4;
+        PontoRegiao *novos = (PontoRegiao *)realloc(b -> pontos, capacidade * sizeof(PontoRegiao));
+        if (!novos) {
+            return false;
+        }
+        b -> pontos = novos;
+        b -> capacidade = capacidade;
+    }
+
+    PontoRegiao p = { x, y, frequencia };
+    b -> pontos[b -> numPontos++] = p;
+    if (fora) b -> foraDoMapa++;
+    ind -> numAntenas++;
+
+    return true;
+
+}
+
+/**
+ * @brief Constrói o índice de regiões com todas as antenas da lista.
+ *
+ * @param lista Lista ligada de antenas.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @return Índice construído, ou false em caso de falha de memória.
+ */
+
+IndiceRegioes *construirIndiceRegioes(Antena *lista, int linhas, int colunas) {
+
+    IndiceRegioes *ind = (IndiceRegioes *)calloc(1, sizeof(IndiceRegioes));
+    if (!ind) {
+        return false;
+    }
+
+    long n = 0;
+    for (Antena *a = lista; a; a = a -> proximo) n++;
+
+    ind -> linhas = linhas > 0 ? linhas : 1;
+    ind -> colunas = colunas > 0 ? colunas : 1;
+
+    // Menor lado tal que um balde tenha, em média, pelo menos ANTENAS_POR_BALDE antenas
+    double alvo = (double)ind -> linhas * ind -> colunas * ANTENAS_POR_BALDE / (n > 0 ? n : 1);
+    int baixo = 1, alto = ind -> linhas > ind -> colunas ? ind -> linhas : ind -> colunas;
+    while (baixo < alto) {
+        int meio = baixo + (alto - baixo) / 2;
+        if ((double)meio * meio >= alvo) alto = meio; else baixo = meio + 1;
+    }
+    ind -> lado = baixo;
+
+    ind -> baldesX = (ind -> linhas + ind -> lado - 1) / ind -> lado;
+    ind -> baldesY = (ind -> colunas + ind -> lado - 1) / ind -> lado;
+    ind -> baldes = (BaldeRegiao *)calloc((size_t)ind -> baldesX * ind -> baldesY, sizeof(BaldeRegiao));
+
+    if (!ind -> baldes) {
+        return libertarIndiceRegioes(ind);
+    }
+
+    for (Antena *a = lista; a; a = a -> proximo) {
+        if (!guardarPonto(ind, a -> frequencia, a -> x, a -> y)) {
+            return libertarIndiceRegioes(ind);
+        }
+    }
+
+    return ind;
+
+}
+
+/**
+ * @brief Regista a inserção de uma antena (acompanha `inserirAntena`).
+ *
+ * @param ind Índice.
+ * @param frequencia Frequência.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a antena foi registada, false em caso de falha de memória.
+ */
+
+bool inserirAntenaRegiao(IndiceRegioes *ind, Frequencia frequencia, int x, int y) {
+
+    if (!ind) {
+        return false;
+    }
+
+    return guardarPonto(ind, frequencia, x, y);
+
+}
+
+/**
+ * @brief Regista a remoção de uma antena (acompanha `removerAntena`).
+ *
+ * @param ind Índice.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return true se a antena existia no índice.
+ */
+
+bool removerAntenaRegiao(IndiceRegioes *ind, int x, int y) {
+
+    if (!ind) {
+        return false;
+    }
+
+    bool fora;
+    BaldeRegiao *b = &ind -> baldes[baldeDe(ind, x, y, &fora)];
+
+    for (int i = 0; i < b -> numPontos; i++) {
+        if (b -> pontos[i].x == x && b -> pontos[i].y == y) {
+            b -> pontos[i] = b -> pontos[--b -> numPontos];
+            if (fora) b -> foraDoMapa--;
+            ind -> numAntenas--;
+            return true;
+        }
+    }
+
+    return false;
+
+}
+
+/**
+ * @brief Ordena os cantos do retângulo e obtém o intervalo de baldes que o interseta.
+ *
+ * @param ind Índice.
+ * @param x1 Primeira linha (atualizada).
+ * @param y1 Primeira coluna (atualizada).
+ * @param x2 Última linha (atualizada).
+ * @param y2 Última coluna (atualizada).
+ * @param b Intervalo de baldes {bx1, by1, bx2, by2}.
+ */
+
+static void baldesRetangulo(const IndiceRegioes *ind, int *x1, int *y1, int *x2, int *y2, int b[4]) {
+
+    if (*x1 > *x2) { int t = *x1; *x1 = *x2; *x2 = t; }
+    if (*y1 > *y2) { int t = *y1; *y1 = *y2; *y2 = t; }
+
+    int canto1 = baldeDe(ind, *x1, *y1, NULL);
+    int canto2 = baldeDe(ind, *x2, *y2, NULL);
+
+    b[0] = canto1 / ind -> baldesY;
+    b[1] = canto1 % ind -> baldesY;
+    b[2] = canto2 / ind -> baldesY;
+    b[3] = canto2 % ind -> baldesY;
+
+}
+
+/**
+ * @brief Verifica se o retângulo cobre todas as células de um balde.
+ *
+ * @param ind Índice.
+ * @param bx Linha do balde.
+ * @param by Coluna do balde.
+ * @param x1 Primeira linha do retângulo.
+ * @param y1 Primeira coluna do retângulo.
+ * @param x2 Última linha do retângulo.
+ * @param y2 Última coluna do retângulo.
+ * @return true se o balde está contido no retângulo e não guarda antenas de fora do mapa.
+ */
+
+static bool baldeCoberto(const IndiceRegioes *ind, int bx, int by, int x1, int y1, int x2, int y2) {
+
+    if (ind -> baldes[bx * ind -> baldesY + by].foraDoMapa) {
+        return false;
+    }
+
+    long inicioX = (long)bx * ind -> lado, fimX = inicioX + ind -> lado - 1;
+    long inicioY = (long)by * ind -> lado, fimY = inicioY + ind -> lado - 1;
+
+    return x1 <= inicioX && fimX <= x2 && y1 <= inicioY && fimY <= y2;
+
+}
+
+/**
+ * @brief Verifica se uma antena está no retângulo e passa o filtro de frequência.
+ *
+ * @param p Antena.
+ * @param x1 Primeira linha.
+ * @param y1 Primeira coluna.
+ * @param x2 Última linha.
+ * @param y2 Última coluna.
+ * @param frequencia Filtro de frequência.
+ * @return true se a antena conta para a consulta.
+ */
+
+static bool pontoNoRetangulo(const PontoRegiao *p, int x1, int y1, int x2, int y2, Frequencia frequencia) {
+
+    return p -> x >= x1 && p -> x <= x2 && p -> y >= y1 && p -> y <= y2 &&
+           (frequencia == FREQUENCIA_QUALQUER || p -> frequencia == frequencia);
+
+}
+
+/**
+ * @brief Obtém as antenas de um retângulo (limites inclusive).
+ *
+ * @param ind Índice.
+ * @param x1 Primeira linha.
+ * @param y1 Primeira coluna.
+ * @param x2 Última linha.
+ * @param y2 Última coluna.
+ * @param frequencia Frequência pretendida (FREQUENCIA_QUALQUER para todas).
+ * @return Lista (sem ordem definida) das posições encontradas, ou NULL se não houver nenhuma
+ *         ou faltar memória.
+ */
+
+Coordenada *antenasRetangulo(const IndiceRegioes *ind, int x1, int y1, int x2, int y2, Frequencia frequencia) {
+
+    if (!ind) {
+        return NULL;
+    }
+
+    int b[4];
+    baldesRetangulo(ind, &x1, &y1, &x2, &y2, b);
+
+    Coordenada *lista = NULL;
+    for (int bx = b[0]; bx <= b[2]; bx++) {
+        for (int by = b[1]; by <= b[3]; by++) {
+
+            const BaldeRegiao *balde = &ind -> baldes[bx * ind -> baldesY + by];
+            bool coberto = baldeCoberto(ind, bx, by, x1, y1, x2, y2);
+
+            for (int i = 0; i < balde -> numPontos; i++) {
+
+                const PontoRegiao *p = &balde -> pontos[i];
+                if (coberto ? (frequencia != FREQUENCIA_QUALQUER && p -> frequencia != frequencia)
+                            : !pontoNoRetangulo(p, x1, y1, x2, y2, frequencia)) {
+                    continue;
+                }
+
+                Coordenada *nova = (Coordenada *)malloc(sizeof(Coordenada));
+                if (!nova) {
+                    return libertarCoordenadas(lista);
+                }
+                nova -> x = p -> x;
+                nova -> y = p -> y;
+                nova -> proximo = lista;
+                lista = nova;
+
+            }
+
+        }
+    }
+
+    return lista;
+
+}
+
+/**
+ * @brief Conta as antenas de um retângulo (limites inclusive).
+ *
+ * Sem filtro de frequência, os baldes totalmente cobertos somam o seu tamanho
+ * sem percorrer as antenas.
+ *
+ * @param ind Índice.
+ * @param x1 Primeira linha.
+ * @param y1 Primeira coluna.
+ * @param x2 Última linha.
+ * @param y2 Última coluna.
+ * @param frequencia Frequência pretendida (FREQUENCIA_QUALQUER para todas).
+ * @return Número de antenas no retângulo.
+ */
+
+long contarRetangulo(const IndiceRegioes *ind, int x1, int y1, int x2, int y2, Frequencia frequencia) {
+
+    if (!ind) {
+        return 0;
+    }
+
+    int b[4];
+    baldesRetangulo(ind, &x1, &y1, &x2, &y2, b);
+
+    long total = 0;
+    for (int bx = b[0]; bx <= b[2]; bx++) {
+        for (int by = b[1]; by <= b[3]; by++) {
+
+            const BaldeRegiao *balde = &ind -> baldes[bx * ind -> baldesY + by];
+
+            if (frequencia == FREQUENCIA_QUALQUER && baldeCoberto(ind, bx, by, x1, y1, x2, y2)) {
+                total += balde -> numPontos;
+                continue;
+            }
+
+            for (int i = 0; i < balde -> numPontos; i++) {
+                if (pontoNoRetangulo(&balde -> pontos[i], x1, y1, x2, y2, frequencia)) total++;
+            }
+
+        }
+    }
+
+    return total;
+
+}
+
+/**
+ * @brief Liberta o índice de regiões.
+ *
+ * @param ind Índice.
+ * @return false após a libertação.
+ */
+
+IndiceRegioes *libertarIndiceRegioes(IndiceRegioes *ind) {
+
+    if (!ind) {
+        return false;
+    }
+
+    if (ind -> baldes) {
+        for (long i = 0; i < (long)ind -> baldesX * ind -> baldesY; i++) {
+            free(ind -> baldes[i].pontos);
+        }
+    }
+    free(ind -> baldes);
+    free(ind);
+
+    return false;
+
+}
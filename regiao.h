@@ -0,0 +1,75 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file regiao.h
+ * @author Thiago Abreu
+ * @brief Índice de regiões: antenas de um retângulo do mapa sem percorrer a lista.
+ *
+ * O mapa é dividido numa grelha de baldes quadrados. Uma consulta por retângulo
+ * só visita os baldes que o intersetam; os baldes totalmente cobertos contribuem
+ * para a contagem sem olhar para as antenas (quando não há filtro de frequência).
+ * Inserções e remoções atualizam apenas o balde da antena.
+ */
+
+#ifndef REGIAO_H
+#define REGIAO_H
+
+#include <stdbool.h>
+#include "antenas.h"
+
+/** Número médio de antenas por balde pretendido na construção. */
+#define ANTENAS_POR_BALDE 8
+
+/**
+ * @struct PontoRegiao
+ * @brief Antena guardada num balde.
+ */
+
+typedef struct PontoRegiao {
+    int x, y;              /**< Coordenadas da antena */
+    Frequencia frequencia; /**< Frequência da antena */
+} PontoRegiao;
+
+/**
+ * @struct BaldeRegiao
+ * @brief Antenas de um quadrado da grelha.
+ */
+
+typedef struct BaldeRegiao {
+    int numPontos;         /**< Antenas no balde */
+    int capacidade;        /**< Capacidade do vetor de pontos */
+    int foraDoMapa;        /**< Antenas fora dos limites do mapa guardadas neste balde da margem */
+    PontoRegiao *pontos;   /**< Antenas do balde */
+} BaldeRegiao;
+
+/**
+ * @struct IndiceRegioes
+ * @brief Grelha de baldes sobre o mapa.
+ *
+ * O balde (bx, by) cobre as linhas [bx * lado, (bx + 1) * lado) e as colunas
+ * [by * lado, (by + 1) * lado). As antenas fora do mapa ficam no balde da margem
+ * mais próximo, que passa a ser sempre verificado antena a antena.
+ */
+
+typedef struct IndiceRegioes {
+    int linhas, colunas;   /**< Dimensões do mapa */
+    int lado;              /**< Lado de cada balde, em células */
+    int baldesX, baldesY;  /**< Número de baldes em cada dimensão */
+    long numAntenas;       /**< Total de antenas indexadas */
+    BaldeRegiao *baldes;   /**< Baldes, por linhas */
+} IndiceRegioes;
+
+IndiceRegioes *construirIndiceRegioes(Antena *lista, int linhas, int colunas);
+bool inserirAntenaRegiao(IndiceRegioes *ind, Frequencia frequencia, int x, int y);
+bool removerAntenaRegiao(IndiceRegioes *ind, int x, int y);
+Coordenada *antenasRetangulo(const IndiceRegioes *ind, int x1, int y1, int x2, int y2, Frequencia frequencia);
+long contarRetangulo(const IndiceRegioes *ind, int x1, int y1, int x2, int y2, Frequencia frequencia);
+IndiceRegioes *libertarIndiceRegioes(IndiceRegioes *ind);
+
+#endif
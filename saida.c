@@ -0,0 +1,322 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file saida.c
+ * @author Thiago Abreu
+ * @brief Implementação da escrita com tampão e do mapa anotado.
+ *
+ * Os inteiros e as coordenadas são convertidos diretamente para o tampão, sem
+ * passar por `printf`. O mapa anotado é desenhado linha a linha: os locais nefastos
+ * são primeiro marcados num mapa de bits e cada linha é composta numa só passagem,
+ * percorrendo em paralelo a lista de antenas, que já está ordenada por (x, y).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "saida.h"
+
+/** Espaço mínimo livre garantido antes de converter um número ou uma coordenada. */
+#define RESERVA_NUMERO 48
+
+/**
+ * @brief Garante que o tampão tem pelo menos `bytes` livres, descarregando-o se preciso.
+ *
+ * @param s Saída.
+ * @param bytes Espaço necessário.
+ * @return true se o espaço está disponível no tampão.
+ */
+
+static bool reservar(Saida *s, size_t bytes) {
+
+    if (s -> capacidade - s -> usado >= bytes) {
+        return true;
+    }
+
+    descarregarSaida(s);
+
+    return s -> capacidade >= bytes;
+
+}
+
+/**
+ * @brief Cria uma saída com tampão sobre um ficheiro já aberto.
+ *
+ * @param destino Ficheiro de destino (por exemplo, stdout).
+ * @param capacidade Tamanho do tampão em bytes (0 usa CAPACIDADE_SAIDA_PADRAO).
+ * @return Saída criada, ou false em caso de falha de memória.
+ */
+
+Saida *criarSaida(FILE *destino, size_t capacidade) {
+
+    if (!destino) {
+        return false;
+    }
+
+    if (capacidade < RESERVA_NUMERO) {
+        capacidade = capacidade == 0 ? CAPACIDADE_SAIDA_PADRAO : RESERVA_NUMERO;
+    }
+
+    Saida *s = (Saida *)calloc(1, sizeof(Saida));
+    if (!s) {
+        return false;
+    }
+
+    s -> tampao = (char *)malloc(capacidade);
+    if (!s -> tampao) {
+        free(s);
+        return false;
+    }
+
+    s -> destino = destino;
+    s -> capacidade = capacidade;
+
+    return s;
+
+}
+
+/**
+ * @brief Escreve um texto terminado em '\0'.
+ *
+ * Textos maiores do que o tampão são escritos diretamente no ficheiro.
+ *
+ * @param s Saída.
+ * @param texto Texto a escrever.
+ */
+
+void escreverTexto(Saida *s, const char *texto) {
+
+    size_t tamanho = strlen(texto);
+
+    if (!reservar(s, tamanho)) {
+        if (fwrite(texto, 1, tamanho, s -> destino) != tamanho) s -> erro = true;
+        return;
+    }
+
+    memcpy(s -> tampao + s -> usado, texto, tamanho);
+    s -> usado += tamanho;
+
+}
+
+/**
+ * @brief Escreve um único carácter.
+ *
+ * @param s Saída.
+ * @param c Carácter a escrever.
+ */
+
+void escreverCaracter(Saida *s, char c) {
+
+    reservar(s, 1);
+    s -> tampao[s -> usado++] = c;
+
+}
+
+/**
+ * @brief Escreve um inteiro em base 10.
+ *
+ * @param s Saída.
+ * @param valor Valor a escrever.
+ */
+
+void escreverInteiro(Saida *s, long valor) {
+
+    reservar(s, RESERVA_NUMERO);
+
+    char digitos[24];
+    int n = 0;
+    unsigned long v = valor < 0 ? 0UL - (unsigned long)valor : (unsigned long)valor;
+
+    do {
+        digitos[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+
+    if (valor < 0) s -> tampao[s -> usado++] = '-';
+    while (n > 0) s -> tampao[s -> usado++] = digitos[--n];
+
+}
+
+/**
+ * @brief Escreve uma coordenada no formato "(x, y)".
+ *
+ * @param s Saída.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ */
+
+void escreverCoordenada(Saida *s, int x, int y) {
+
+    reservar(s, RESERVA_NUMERO);
+
+    s -> tampao[s -> usado++] = '(';
+    escreverInteiro(s, x);
+    s -> tampao[s -> usado++] = ',';
+    s -> tampao[s -> usado++] = ' ';
+    escreverInteiro(s, y);
+    s -> tampao[s -> usado++] = ')';
+
+}
+
+/**
+ * @brief Escreve texto formatado como `printf`.
+ *
+ * @param s Saída.
+ * @param formato Formato, com a sintaxe de `printf`.
+ */
+
+void escreverFormatado(Saida *s, const char *formato, ...) {
+
+    va_list args;
+
+    va_start(args, formato);
+    int tamanho = vsnprintf(s -> tampao + s -> usado, s -> capacidade - s -> usado, formato, args);
+    va_end(args);
+
+    if (tamanho < 0) {
+        s -> erro = true;
+        return;
+    }
+
+    if ((size_t)tamanho < s -> capacidade - s -> usado) {
+        s -> usado += tamanho;
+        return;
+    }
+
+    // Não coube: descarrega e volta a formatar (diretamente no ficheiro se exceder o tampão)
+    descarregarSaida(s);
+
+    va_start(args, formato);
+    if ((size_t)tamanho < s -> capacidade) {
+        s -> usado += vsnprintf(s -> tampao, s -> capacidade, formato, args);
+    } else if (vfprintf(s -> destino, formato, args) < 0) {
+        s -> erro = true;
+    }
+    va_end(args);
+
+}
+
+/**
+ * @brief Desenha o mapa com as antenas e os locais nefastos marcados com '#'.
+ *
+ * Uma célula com antena mostra a frequência da antena mesmo que também seja um
+ * local nefasto; as restantes células mostram '#' ou '.'. Frequências sem
+ * representação visível (espaços, '\r') não se sobrepõem à marcação. Locais fora
+ * do mapa são ignorados.
+ *
+ * @param s Saída.
+ * @param antenas Lista de antenas, ordenada por (x, y).
+ * @param nefastos Lista de locais nefastos.
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ */
+
+void escreverMapaAnotado(Saida *s, Antena *antenas, Coordenada *nefastos, int linhas, int colunas) {
+
+    if (linhas <= 0 || colunas <= 0) {
+        return;
+    }
+
+    size_t palavrasLinha = ((size_t)colunas + 63) / 64;
+    uint64_t *marcados = (uint64_t *)calloc((size_t)linhas * palavrasLinha, sizeof(uint64_t));
+    char *linha = (char *)malloc((size_t)colunas + 1);
+
+    if (!marcados || !linha) {
+        free(marcados);
+        free(linha);
+        s -> erro = true;
+        return;
+    }
+
+    for (Coordenada *c = nefastos; c; c = c -> proximo) {
+        if (c -> x >= 0 && c -> x < linhas && c -> y >= 0 && c -> y < colunas) {
+            marcados[(size_t)c -> x * palavrasLinha + c -> y / 64] |= (uint64_t)1 << (c -> y % 64);
+        }
+    }
+
+    Antena *a = antenas;
+    for (int x = 0; x < linhas; x++) {
+
+        memset(linha, '.', colunas);
+        linha[colunas] = '\n';
+
+        const uint64_t *palavras = marcados + (size_t)x * palavrasLinha;
+        for (size_t w = 0; w < palavrasLinha; w++) {
+            uint64_t bits = palavras[w];
+            while (bits) {
+                linha[w * 64 + __builtin_ctzll(bits)] = '#';
+                bits &= bits - 1;
+            }
+        }
+
+        while (a && a -> x < x) a = a -> proximo;
+        for (; a && a -> x == x; a = a -> proximo) {
+            // Só os nomes de um carácter visível cabem numa célula do mapa
+            const char *nome = nomeFrequencia(a -> frequencia);
+            if (a -> y >= 0 && a -> y < colunas && nome[0] && !nome[1] && isgraph((unsigned char)nome[0])) {
+                linha[a -> y] = nome[0];
+            }
+        }
+
+        if (reservar(s, (size_t)colunas + 1)) {
+            memcpy(s -> tampao + s -> usado, linha, (size_t)colunas + 1);
+            s -> usado += (size_t)colunas + 1;
+        } else if (fwrite(linha, 1, (size_t)colunas + 1, s -> destino) != (size_t)colunas + 1) {
+            s -> erro = true;
+        }
+
+    }
+
+    free(marcados);
+    free(linha);
+
+}
+
+/**
+ * @brief Envia o conteúdo do tampão para o ficheiro.
+ *
+ * @param s Saída.
+ * @return true se todas as escritas até agora tiveram sucesso.
+ */
+
+bool descarregarSaida(Saida *s) {
+
+    if (s -> usado > 0) {
+        if (fwrite(s -> tampao, 1, s -> usado, s -> destino) != s -> usado) s -> erro = true;
+        s -> usado = 0;
+    }
+
+    fflush(s -> destino);
+
+    return !s -> erro;
+
+}
+
+/**
+ * @brief Descarrega o tampão e liberta a saída (o ficheiro não é fechado).
+ *
+ * @param s Saída.
+ * @return false após a libertação completa.
+ */
+
+Saida *libertarSaida(Saida *s) {
+
+    if (!s) {
+        return false;
+    }
+
+    descarregarSaida(s);
+    free(s -> tampao);
+    free(s);
+
+    return false;
+
+}
@@ -0,0 +1,54 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file saida.h
+ * @author Thiago Abreu
+ * @brief Escrita de resultados através de um tampão de grandes dimensões.
+ *
+ * O texto é formatado em memória e só é enviado para o ficheiro quando o tampão
+ * enche ou é descarregado explicitamente, trocando milhões de pequenas escritas
+ * por poucas escritas grandes. Inclui ainda o desenho do mapa anotado com os
+ * locais nefastos.
+ */
+
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "antenas.h"
+
+/** Capacidade do tampão usada quando não é indicada outra. */
+#define CAPACIDADE_SAIDA_PADRAO (1 << 20)
+
+/**
+ * @struct Saida
+ * @brief Destino de escrita com tampão próprio.
+ */
+
+typedef struct Saida {
+    FILE *destino;       /**< Ficheiro onde o tampão é descarregado */
+    char *tampao;        /**< Texto ainda por escrever */
+    size_t usado;        /**< Bytes ocupados no tampão */
+    size_t capacidade;   /**< Tamanho do tampão */
+    bool erro;           /**< true se alguma escrita falhou */
+} Saida;
+
+Saida *criarSaida(FILE *destino, size_t capacidade);
+void escreverTexto(Saida *s, const char *texto);
+void escreverCaracter(Saida *s, char c);
+void escreverInteiro(Saida *s, long valor);
+void escreverCoordenada(Saida *s, int x, int y);
+void escreverFormatado(Saida *s, const char *formato, ...);
+void escreverMapaAnotado(Saida *s, Antena *antenas, Coordenada *nefastos, int linhas, int colunas);
+bool descarregarSaida(Saida *s);
+Saida *libertarSaida(Saida *s);
+
+#endif
@@ -0,0 +1,797 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file servidor.c
+ * @author Thiago Abreu
+ * @brief Implementação do modo servidor com o mapa residente em memória.
+ *
+ * Cada comando ocupa uma linha e a resposta termina sempre com uma linha
+ * "ok <n> <tempo> ms" ou "erro <motivo>", onde o tempo é a latência do pedido.
+ * Comandos: inserir F x y, remover x y, ligar x1 y1 x2 y2, ligacoes ficheiro,
+ * visiveis, raio R, proxima x y [F], vizinhas x y k [F], zona x y R [F],
+ * retangulo x1 y1 x2 y2 [F], contar x1 y1 x2 y2 [F], nefastos, colineares,
+ * largura x y, profundidade x y, caminhos x1 y1 x2 y2 [max] [segundos],
+ * intersecoes A B, fecho [MB], alcanca x1 y1 x2 y2, analise [amostras], causas x y,
+ * densidade x1 y1 x2 y2, ordenar [sim|nao], estado, ajuda, sair e desligar.
+ * Só `inserir` regista frequências novas; nas consultas, um nome desconhecido
+ * dá um resultado vazio sem fazer crescer o dicionário.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#ifndef _WIN32
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+#include "servidor.h"
+#include "funcoes.h"
+#include "nefastos.h"
+#include "procuras.h"
+#include "caminhos.h"
+#include "ligacoes.h"
+#include "analise.h"
+#include "compacto.h"
+#include "ordenacao.h"
+#include "tarefas.h"
+#include "tempo.h"
+
+/** Tamanho máximo de uma linha de comando. */
+#define TAMANHO_LINHA 512
+
+/**
+ * @brief Marca as estruturas derivadas como desatualizadas após uma alteração.
+ *
+ * @param estado Mapa residente.
+ * @param grafoAlterado true se o grafo mudou (invalida o grafo compacto).
+ * @param antenasAlteradas true se as antenas mudaram (invalida os locais nefastos).
+ */
+
+static void invalidar(EstadoMapa *estado, bool grafoAlterado, bool antenasAlteradas) {
+
+    if (grafoAlterado) {
+        estado -> csr = libertarGrafoCSR(estado -> csr);
+        estado -> grupos = libertarGruposFrequencia(estado -> grupos);
+        estado -> fecho = libertarFecho(estado -> fecho);
+    }
+
+    if (antenasAlteradas) {
+        estado -> nefastos = libertarCoordenadas(estado -> nefastos);
+        estado -> nefastosValidos = false;
+        estado -> colineares = libertarCoordenadas(estado -> colineares);
+        estado -> colinearesValidos = false;
+        estado -> interferencia = libertarIndiceInterferencia(estado -> interferencia);
+        estado -> densidade = libertarGrelhaInterferencia(estado -> densidade);
+    }
+
+}
+
+/**
+ * @brief Obtém o grafo compacto, reconstruindo-o só se o grafo tiver mudado.
+ *
+ * @param estado Mapa residente.
+ * @return Grafo compacto atualizado, ou NULL em caso de falha de memória.
+ */
+
+static GrafoCSR *grafoCompacto(EstadoMapa *estado) {
+
+    if (!estado -> csr) {
+        estado -> csr = construirGrafoCSR(estado -> grafo);
+    }
+
+    return estado -> csr;
+
+}
+
+/**
+ * @brief Escreve uma lista de coordenadas, uma por linha.
+ *
+ * Com a saída ordenada, a lista é primeiro reordenada por (x, y) no próprio lugar;
+ * as listas guardadas no estado ficam assim ordenadas para os pedidos seguintes.
+ *
+ * @param saida Destino da resposta.
+ * @param lista Apontador para a cabeça da lista de coordenadas.
+ * @param ordenar true para escrever por ordem (x, y).
+ * @return Número de coordenadas escritas.
+ */
+
+static long escreverCoordenadas(FILE *saida, Coordenada **lista, bool ordenar) {
+
+    if (ordenar) {
+        *lista = ordenarCoordenadas(*lista);
+    }
+
+    long n = 0;
+    for (Coordenada *c = *lista; c; c = c -> proximo, n++) {
+        fprintf(saida, "(%d, %d)\n", c -> x, c -> y);
+    }
+
+    return n;
+
+}
+
+/**
+ * @brief Carrega o mapa de um ficheiro para o estado residente.
+ *
+ * @param estado Estado a preencher.
+ * @param nomeFicheiro Ficheiro com a matriz de antenas.
+ * @return true se o mapa foi carregado.
+ */
+
+bool carregarEstadoMapa(EstadoMapa *estado, const char *nomeFicheiro) {
+
+    memset(estado, 0, sizeof(EstadoMapa));
+
+    estado -> antenas = carregarAntenas(nomeFicheiro, &estado -> linhas, &estado -> colunas);
+    if (!estado -> antenas) {
+        return false;
+    }
+
+    estado -> grafo = carregarGrafo(nomeFicheiro, &estado -> linhas, &estado -> colunas);
+    estado -> indiceGrafo = construirIndiceCoordenadas(estado -> grafo);
+    if (!estado -> indiceGrafo) {
+        libertarEstadoMapa(estado);
+        return false;
+    }
+
+    return true;
+
+}
+
+/**
+ * @brief Liberta o mapa residente e todas as estruturas derivadas.
+ *
+ * @param estado Mapa residente.
+ */
+
+void libertarEstadoMapa(EstadoMapa *estado) {
+
+    invalidar(estado, true, true);
+    estado -> proximidade = libertarArvoreKD(estado -> proximidade);
+    estado -> regioes = libertarIndiceRegioes(estado -> regioes);
+    estado -> antenas = libertarAntenas(estado -> antenas);
+    estado -> grafo = libertarGrafo(estado -> grafo);
+    estado -> indiceGrafo = libertarIndiceCoordenadas(estado -> indiceGrafo);
+
+}
+
+/**
+ * @brief Interpreta e executa um comando, escrevendo a resposta.
+ *
+ * @param estado Mapa residente.
+ * @param linha Linha com o comando.
+ * @param saida Destino da resposta.
+ * @return false se o comando terminar a sessão (sair ou desligar), true caso contrário.
+ */
+
+bool processarComando(EstadoMapa *estado, const char *linha, FILE *saida) {
+
+    char comando[32] = "";
+    if (sscanf(linha, "%31s", comando) != 1) {
+        return true; // Linha vazia
+    }
+
+    const char *args = strstr(linha, comando) + strlen(comando);
+    double inicio = tempoAtual();
+    long resultados = 0;
+    const char *erro = NULL;
+    int x1, y1, x2, y2;
+    Frequencia f1 = FREQUENCIA_QUALQUER, f2 = FREQUENCIA_QUALQUER;
+    char nome1[TAMANHO_NOME_FREQUENCIA], nome2[TAMANHO_NOME_FREQUENCIA];
+    bool desconhecida = false; // Consulta com uma frequência que nenhuma antena usou
+
+    if (strcmp(comando, "sair") == 0 || strcmp(comando, "quit") == 0) {
+
+        fprintf(saida, "ok 0 0.000 ms\n");
+        fflush(saida);
+        return false;
+
+    } else if (strcmp(comando, "desligar") == 0 || strcmp(comando, "shutdown") == 0) {
+
+        estado -> desligar = true;
+        fprintf(saida, "ok 0 0.000 ms\n");
+        fflush(saida);
+        return false;
+
+    } else if (strcmp(comando, "inserir") == 0 || strcmp(comando, "insert") == 0) {
+
+        if (sscanf(args, "%31s %d %d", nome1, &x1, &y1) != 3) {
+            erro = "uso: inserir F x y";
+        } else if ((f1 = codificarFrequencia(nome1)) == FREQUENCIA_QUALQUER) {
+            erro = "dicionario de frequencias cheio";
+        } else {
+            Antena *nova = inserirAntena(estado -> antenas, f1, x1, y1);
+            if (!nova) {
+                erro = "posicao ocupada ou falha de memoria";
+            } else {
+                estado -> antenas = nova;
+                if (estado -> proximidade && !inserirPontoKD(estado -> proximidade, f1, x1, y1)) {
+                    estado -> proximidade = libertarArvoreKD(estado -> proximidade);
+                }
+                if (estado -> regioes && !inserirAntenaRegiao(estado -> regioes, f1, x1, y1)) {
+                    estado -> regioes = libertarIndiceRegioes(estado -> regioes);
+                }
+                estado -> grafo = inserirVerticeIndexado(estado -> grafo, estado -> indiceGrafo, f1, x1, y1, NULL);
+                invalidar(estado, true, true);
+                resultados = 1;
+            }
+        }
+
+    } else if (strcmp(comando, "remover") == 0 || strcmp(comando, "remove") == 0) {
+
+        bool removido = false;
+        if (sscanf(args, "%d %d", &x1, &y1) != 2) {
+            erro = "uso: remover x y";
+        } else {
+            estado -> antenas = removerAntena(estado -> antenas, x1, y1, &removido);
+            if (!removido) {
+                erro = "nenhuma antena nessa posicao";
+            } else {
+                removerPontoKD(estado -> proximidade, x1, y1);
+                removerAntenaRegiao(estado -> regioes, x1, y1);
+                estado -> grafo = removerVerticeIndexado(estado -> grafo, estado -> indiceGrafo, x1, y1, NULL);
+                invalidar(estado, true, true);
+                resultados = 1;
+            }
+        }
+
+    } else if (strcmp(comando, "ligar") == 0 || strcmp(comando, "link") == 0) {
+
+        if (sscanf(args, "%d %d %d %d", &x1, &y1, &x2, &y2) != 4) {
+            erro = "uso: ligar x1 y1 x2 y2";
+        } else {
+            Vertice *v1 = verticeEm(estado -> indiceGrafo, x1, y1);
+            Vertice *v2 = verticeEm(estado -> indiceGrafo, x2, y2);
+            if (!v1 || !v2 || v1 -> frequencia != v2 -> frequencia) {
+                erro = "vertices inexistentes ou de frequencias diferentes";
+            } else if (!ligarVertices(v1, v2)) {
+                erro = "memoria insuficiente";
+            } else {
+                invalidar(estado, true, false);
+                resultados = 1;
+            }
+        }
+
+    } else if (strcmp(comando, "ligacoes") == 0 || strcmp(comando, "links") == 0) {
+
+        // Ficheiro com uma ligação "x1 y1 x2 y2" por linha
+        char nome[TAMANHO_LINHA];
+        FILE *ficheiro = NULL;
+        if (sscanf(args, "%511s", nome) != 1) {
+            erro = "uso: ligacoes ficheiro";
+        } else if (!(ficheiro = fopen(nome, "r"))) {
+            erro = "ficheiro de ligacoes inacessivel";
+        } else {
+
+            long numPares = 0, capacidade = 0;
+            ParLigacao *pares = NULL, p;
+            bool memoria = true;
+
+            while (memoria && fscanf(ficheiro, "%d %d %d %d", &p.x1, &p.y1, &p.x2, &p.y2) == 4) {
+                if (numPares == capacidade) {
+                    capacidade = capacidade ? 2 * capacidade : 256;
+                    ParLigacao *novos = (ParLigacao *)realloc(pares, capacidade * sizeof(ParLigacao));
+                    if (!novos) {
+                        memoria = false;
+                        break;
+                    }
+                    pares = novos;
+                }
+                pares[numPares++] = p;
+            }
+            fclose(ficheiro);
+
+            ResumoLigacoes r;
+            if (!memoria || !ligarEmLote(estado -> grafo, estado -> indiceGrafo, pares, numPares, &r)) {
+                erro = "memoria insuficiente";
+            } else {
+                fprintf(saida, "criadas %ld, sem vertice %ld, frequencia diferente %ld, duplicadas %ld\n",
+                        r.criadas, r.semVertice, r.frequenciaDiferente, r.duplicadas);
+                if (r.criadas > 0) invalidar(estado, true, false);
+                resultados = r.criadas;
+            }
+            free(pares);
+
+        }
+
+    } else if (strcmp(comando, "visiveis") == 0 || strcmp(comando, "sight") == 0) {
+
+        long criadas = ligarVisiveis(estado -> grafo);
+        if (criadas < 0) {
+            erro = "memoria insuficiente";
+        } else {
+            if (criadas > 0) invalidar(estado, true, false);
+            resultados = criadas;
+        }
+
+    } else if (strcmp(comando, "raio") == 0 || strcmp(comando, "range") == 0) {
+
+        double raio;
+        if (sscanf(args, "%lf", &raio) != 1 || !(raio > 0)) {
+            erro = "uso: raio R (R > 0)";
+        } else {
+            long criadas = ligarRaio(estado -> grafo, raio);
+            if (criadas < 0) {
+                erro = "memoria insuficiente";
+            } else {
+                if (criadas > 0) invalidar(estado, true, false);
+                resultados = criadas;
+            }
+        }
+
+    } else if (strcmp(comando, "nefastos") == 0) {
+
+        if (!estado -> nefastosValidos) {
+            // A cópia compacta custa uma passagem pela lista, muito menos do que os pares
+            MapaCompacto *m = construirMapaCompacto(estado -> antenas, estado -> linhas, estado -> colunas);
+            estado -> nefastos = m ? detectarNefastosCompacto(m, poolGlobal())
+                                   : detectarLocaisNefastosParalelo(estado -> antenas, poolGlobal());
+            libertarMapaCompacto(m);
+            // NULL também indica falta de memória: só fica em cache quando não há antenas ou houve resultado
+            estado -> nefastosValidos = !estado -> antenas || estado -> nefastos;
+        }
+        resultados = escreverCoordenadas(saida, &estado -> nefastos, estado -> saidaOrdenada);
+
+    } else if (strcmp(comando, "colineares") == 0 || strcmp(comando, "collinear") == 0) {
+
+        if (!estado -> colinearesValidos) {
+            estado -> colineares = detectarLocaisColineares(estado -> antenas, estado -> linhas, estado -> colunas);
+            estado -> colinearesValidos = !estado -> antenas || estado -> colineares;
+        }
+        resultados = escreverCoordenadas(saida, &estado -> colineares, estado -> saidaOrdenada);
+
+    } else if (strcmp(comando, "causas") == 0 || strcmp(comando, "causes") == 0) {
+
+        if (sscanf(args, "%d %d", &x1, &y1) != 2) {
+            erro = "uso: causas x y";
+        } else {
+            if (!estado -> interferencia) {
+                estado -> interferencia = construirIndiceInterferencia(estado -> antenas);
+            }
+            IndiceInterferencia *ind = estado -> interferencia;
+            long numPares = 0;
+            const ParAntenas *pares = causasNefasto(ind, x1, y1, &numPares);
+            if (!ind) {
+                erro = "falha de memoria";
+            }
+            for (long k = 0; k < numPares; k++) {
+                int a = pares[k].a, b = pares[k].b;
+                fprintf(saida, "%s (%d, %d) <-> (%d, %d)\n", nomeFrequencia(ind -> frequencia[a]),
+                        ind -> antenaX[a], ind -> antenaY[a], ind -> antenaX[b], ind -> antenaY[b]);
+            }
+            resultados = numPares;
+        }
+
+    } else if (strcmp(comando, "densidade") == 0 || strcmp(comando, "density") == 0) {
+
+        if (sscanf(args, "%d %d %d %d", &x1, &y1, &x2, &y2) != 4) {
+            erro = "uso: densidade x1 y1 x2 y2";
+        } else {
+            if (!estado -> densidade) {
+                estado -> densidade = construirGrelhaInterferencia(estado -> antenas, estado -> linhas, estado -> colunas);
+            }
+            int mx = 0, my = 0;
+            int maximo = maximoRetangulo(estado -> densidade, x1, y1, x2, y2, &mx, &my);
+            if (!estado -> densidade) {
+                erro = "falha de memoria";
+            } else if (maximo < 0) {
+                erro = "retangulo fora do mapa";
+            } else {
+                fprintf(saida, "total %lld maximo %d em (%d, %d)\n",
+                        totalRetangulo(estado -> densidade, x1, y1, x2, y2), maximo, mx, my);
+                resultados = 1;
+            }
+        }
+
+    } else if (strcmp(comando, "proxima") == 0 || strcmp(comando, "nearest") == 0 ||
+               strcmp(comando, "vizinhas") == 0 || strcmp(comando, "knearest") == 0) {
+
+        // proxima x y [F] equivale a vizinhas x y 1 [F]
+        bool varias = strcmp(comando, "vizinhas") == 0 || strcmp(comando, "knearest") == 0;
+        int k = 1, lidos;
+        if (varias) {
+            lidos = sscanf(args, "%d %d %d %31s", &x1, &y1, &k, nome1) - 1;
+        } else {
+            lidos = sscanf(args, "%d %d %31s", &x1, &y1, nome1);
+        }
+        if (lidos == 3) desconhecida = !procurarFrequencia(nome1, &f1);
+
+        if (lidos < 2 || k <= 0) {
+            erro = varias ? "uso: vizinhas x y k [F]" : "uso: proxima x y [F]";
+        } else if (!desconhecida) {
+            if (!estado -> proximidade) {
+                estado -> proximidade = construirArvoreKD(estado -> antenas);
+            }
+            PontoKD *encontrados = (PontoKD *)malloc(k * sizeof(PontoKD));
+            int n = encontrados ? vizinhasKD(estado -> proximidade, x1, y1, f1, k, encontrados) : -1;
+            if (!estado -> proximidade || n < 0) {
+                erro = "memoria insuficiente";
+            } else {
+                for (int i = 0; i < n; i++) {
+                    fprintf(saida, "(%d, %d) %s\n", encontrados[i].x, encontrados[i].y, nomeFrequencia(encontrados[i].frequencia));
+                }
+                resultados = n;
+            }
+            free(encontrados);
+        }
+
+    } else if (strcmp(comando, "zona") == 0 || strcmp(comando, "within") == 0) {
+
+        double raio;
+        int lidos = sscanf(args, "%d %d %lf %31s", &x1, &y1, &raio, nome1);
+        if (lidos == 4) desconhecida = !procurarFrequencia(nome1, &f1);
+
+        if (lidos < 3 || raio < 0) {
+            erro = "uso: zona x y R [F]";
+        } else if (!desconhecida) {
+            if (!estado -> proximidade) {
+                estado -> proximidade = construirArvoreKD(estado -> antenas);
+            }
+            if (!estado -> proximidade) {
+                erro = "memoria insuficiente";
+            } else {
+                Coordenada *zona = raioKD(estado -> proximidade, x1, y1, raio, f1);
+                resultados = escreverCoordenadas(saida, &zona, estado -> saidaOrdenada);
+                libertarCoordenadas(zona);
+            }
+        }
+
+    } else if (strcmp(comando, "retangulo") == 0 || strcmp(comando, "viewport") == 0 ||
+               strcmp(comando, "contar") == 0 || strcmp(comando, "count") == 0) {
+
+        bool contar = strcmp(comando, "contar") == 0 || strcmp(comando, "count") == 0;
+        int lidos = sscanf(args, "%d %d %d %d %31s", &x1, &y1, &x2, &y2, nome1);
+        if (lidos == 5) desconhecida = !procurarFrequencia(nome1, &f1);
+
+        if (lidos < 4) {
+            erro = contar ? "uso: contar x1 y1 x2 y2 [F]" : "uso: retangulo x1 y1 x2 y2 [F]";
+        } else if (!desconhecida) {
+            if (!estado -> regioes) {
+                estado -> regioes = construirIndiceRegioes(estado -> antenas, estado -> linhas, estado -> colunas);
+            }
+            if (!estado -> regioes) {
+                erro = "memoria insuficiente";
+            } else if (contar) {
+                resultados = contarRetangulo(estado -> regioes, x1, y1, x2, y2, f1);
+            } else {
+                Coordenada *encontradas = antenasRetangulo(estado -> regioes, x1, y1, x2, y2, f1);
+                resultados = escreverCoordenadas(saida, &encontradas, estado -> saidaOrdenada);
+                libertarCoordenadas(encontradas);
+            }
+        }
+
+    } else if (strcmp(comando, "largura") == 0 || strcmp(comando, "bfs") == 0 ||
+               strcmp(comando, "profundidade") == 0 || strcmp(comando, "dfs") == 0) {
+
+        GrafoCSR *g = grafoCompacto(estado);
+        int origem = -1;
+
+        if (sscanf(args, "%d %d", &x1, &y1) != 2) {
+            erro = "uso: largura|profundidade x y";
+        } else if (!g) {
+            erro = "falha de memoria";
+        } else if ((origem = indiceVerticeCSR(g, x1, y1)) < 0) {
+            erro = "nenhuma antena nessa posicao";
+        } else if (comando[0] == 'l' || comando[0] == 'b') {
+            // A origem é sempre alcançada, pelo que uma lista vazia é falta de memória
+            DistanciasLargura *d = procuraLarguraParalela(g, origem, poolGlobal());
+            Coordenada *alcancados = d ? alcancadosLargura(d, g, 0) : NULL;
+            if (!alcancados) {
+                erro = "falha de memoria";
+            } else {
+                resultados = escreverCoordenadas(saida, &alcancados, estado -> saidaOrdenada);
+            }
+            libertarCoordenadas(alcancados);
+            libertarDistanciasLargura(d);
+        } else {
+            Coordenada *alcancados = procuraProfundidadeCSR(g, origem);
+            if (!alcancados) {
+                erro = "falha de memoria";
+            } else {
+                resultados = escreverCoordenadas(saida, &alcancados, estado -> saidaOrdenada);
+            }
+            libertarCoordenadas(alcancados);
+        }
+
+    } else if (strcmp(comando, "fecho") == 0 || strcmp(comando, "closure") == 0) {
+
+        // fecho [MB]: (re)constrói o fecho transitivo com o orçamento indicado
+        double megabytes = (double)(ORCAMENTO_FECHO_PADRAO >> 20);
+        int lidos = sscanf(args, "%lf", &megabytes);
+
+        // Sem argumento, sscanf devolve EOF e fica o orçamento padrão; o limite evita que
+        // a conversão para size_t transborde (e rejeita NaN e valores negativos)
+        if (lidos == 0 || !(megabytes >= 0 && megabytes <= (double)(SIZE_MAX >> 21))) {
+            erro = "uso: fecho [MB]";
+        } else {
+            GrafoCSR *g = grafoCompacto(estado);
+            estado -> fecho = libertarFecho(estado -> fecho);
+            if (!g || !(estado -> fecho = construirFecho(g, (size_t)(megabytes * 1048576.0)))) {
+                erro = "memoria insuficiente";
+            } else {
+                fprintf(saida, "componentes %d, fortes %d, necessario %zu bytes, usado %zu bytes, recusadas %d\n",
+                        estado -> fecho -> numComponentes, estado -> fecho -> numFortes, estado -> fecho -> bytesNecessarios,
+                        estado -> fecho -> bytesUsados, estado -> fecho -> componentesRecusadas);
+                resultados = estado -> fecho -> numComponentes;
+            }
+        }
+
+    } else if (strcmp(comando, "alcanca") == 0 || strcmp(comando, "reaches") == 0) {
+
+        if (sscanf(args, "%d %d %d %d", &x1, &y1, &x2, &y2) != 4) {
+            erro = "uso: alcanca x1 y1 x2 y2";
+        } else {
+            GrafoCSR *g = grafoCompacto(estado);
+            if (g && !estado -> fecho) {
+                estado -> fecho = construirFecho(g, ORCAMENTO_FECHO_PADRAO);
+            }
+            int u = indiceVerticeCSR(g, x1, y1), v = indiceVerticeCSR(g, x2, y2);
+            if (!estado -> fecho) {
+                erro = "memoria insuficiente";
+            } else if (u < 0 || v < 0) {
+                erro = "nenhuma antena nessa posicao";
+            } else {
+                int alcance = alcancaFecho(estado -> fecho, u, v);
+                fprintf(saida, "%s\n", alcance == ALCANCE_DESCONHECIDO ? "desconhecido" : alcance ? "sim" : "nao");
+                resultados = 1;
+            }
+        }
+
+    } else if (strcmp(comando, "analise") == 0 || strcmp(comando, "analytics") == 0) {
+
+        int amostras = AMOSTRAS_ANALISE_PADRAO;
+        sscanf(args, "%d", &amostras);
+        GrafoCSR *g = grafoCompacto(estado);
+        AnaliseGrafo *a = g ? analisarGrafo(g, amostras, 2025u) : NULL;
+
+        if (!a) {
+            erro = "memoria insuficiente";
+        } else {
+
+            int diametro = 0;
+            for (int k = 0; k < a -> numComponentes; k++) {
+                if (a -> diametroComponente[k] > diametro) diametro = a -> diametroComponente[k];
+            }
+            fprintf(saida, "componentes %d, diametro maximo %d, grau maximo %d, amostras %d\n",
+                    a -> numComponentes, diametro, a -> grauMaximo, a -> amostras);
+
+            fprintf(saida, "graus:");
+            for (int k = 0; k <= a -> grauMaximo; k++) {
+                if (a -> histogramaGrau[k]) fprintf(saida, " %d:%ld", k, a -> histogramaGrau[k]);
+            }
+            fprintf(saida, "\ntamanhos:");
+            for (int k = 0; k < a -> classesComponentes; k++) {
+                if (a -> histogramaComponentes[k]) fprintf(saida, " [%ld,%ld):%ld", 1L << k, 2L << k, a -> histogramaComponentes[k]);
+            }
+            fprintf(saida, "\n");
+
+            int centrais[5];
+            int n = verticesCentrais(a, 5, centrais);
+            for (int i = 0; i < n; i++) {
+                int v = centrais[i];
+                fprintf(saida, "(%d, %d) %s intermediacao %.1f proximidade %.3f diametro %d\n", g -> x[v], g -> y[v],
+                        nomeFrequencia(g -> frequencia[v]), a -> intermediacao[v], a -> proximidade[v],
+                        a -> diametroComponente[a -> componente[v]]);
+            }
+            resultados = a -> numComponentes;
+            libertarAnaliseGrafo(a);
+
+        }
+
+    } else if (strcmp(comando, "caminhos") == 0 || strcmp(comando, "paths") == 0) {
+
+        LimitesCaminhos limites = { 0, 0, 0 };
+        GrafoCSR *g = grafoCompacto(estado);
+
+        if (sscanf(args, "%d %d %d %d %ld %lf", &x1, &y1, &x2, &y2, &limites.maxCaminhos, &limites.tempoMaximo) < 4) {
+            erro = "uso: caminhos x1 y1 x2 y2 [max] [segundos]";
+        } else if (!g) {
+            erro = "falha de memoria";
+        } else {
+            ListaCaminhos *l = caminhosEntreAntenasParalelo(g, poolGlobal(), x1, y1, x2, y2, limites);
+            if (!l) {
+                erro = "nenhuma antena numa das posicoes";
+            } else {
+                for (int i = 0; i < l -> numCaminhos; i++) {
+                    for (int k = l -> inicioCaminho[i]; k < l -> inicioCaminho[i + 1]; k++) {
+                        int v = l -> vertices[k];
+                        fprintf(saida, "%s(%d, %d)", k > l -> inicioCaminho[i] ? " -> " : "", g -> x[v], g -> y[v]);
+                    }
+                    fprintf(saida, "\n");
+                }
+                if (l -> parcial) fprintf(saida, "parcial\n");
+                resultados = l -> numCaminhos;
+                libertarListaCaminhos(l);
+            }
+        }
+
+    } else if (strcmp(comando, "intersecoes") == 0 || strcmp(comando, "intersections") == 0) {
+
+        GrafoCSR *g = grafoCompacto(estado);
+        if (g && !estado -> grupos) {
+            estado -> grupos = agruparFrequenciasCSR(g);
+        }
+
+        if (sscanf(args, "%31s %31s", nome1, nome2) != 2) {
+            erro = "uso: intersecoes A B";
+        } else if (!procurarFrequencia(nome1, &f1) || !procurarFrequencia(nome2, &f2)) {
+            // Frequência que nenhuma antena usou: sem pares, e o dicionário não cresce
+        } else if (!g || !estado -> grupos) {
+            erro = "falha de memoria";
+        } else {
+            // Com A == B, cada par não ordenado sai uma vez e sem pares de uma antena consigo
+            const int *grupoA = NULL, *grupoB = NULL;
+            int numA = verticesFrequencia(estado -> grupos, f1, &grupoA);
+            int numB = verticesFrequencia(estado -> grupos, f2, &grupoB);
+            for (int i = 0; i < numA; i++) {
+                int a = grupoA[i];
+                for (int j = f1 == f2 ? i + 1 : 0; j < numB; j++) {
+                    int b = grupoB[j];
+                    fprintf(saida, "(%d, %d) <-> (%d, %d)\n", g -> x[a], g -> y[a], g -> x[b], g -> y[b]);
+                    resultados++;
+                }
+            }
+        }
+
+    } else if (strcmp(comando, "ordenar") == 0 || strcmp(comando, "sorted") == 0) {
+
+        // ordenar [sim|nao]: sem argumento, apenas indica o modo atual
+        char modo[8] = "";
+        sscanf(args, "%7s", modo);
+
+        if (strcmp(modo, "sim") == 0 || strcmp(modo, "on") == 0) {
+            estado -> saidaOrdenada = true;
+        } else if (strcmp(modo, "nao") == 0 || strcmp(modo, "off") == 0) {
+            estado -> saidaOrdenada = false;
+        } else if (modo[0]) {
+            erro = "uso: ordenar [sim|nao]";
+        }
+        if (!erro) {
+            fprintf(saida, "saida %s\n", estado -> saidaOrdenada ? "ordenada" : "pela ordem de calculo");
+            resultados = 1;
+        }
+
+    } else if (strcmp(comando, "estado") == 0 || strcmp(comando, "stats") == 0) {
+
+        long antenas = 0, vertices = 0, arcos = 0;
+        for (Antena *a = estado -> antenas; a; a = a -> proximo) antenas++;
+        for (Vertice *v = estado -> grafo; v; v = v -> proximo) {
+            vertices++;
+            for (Aresta *a = v -> arestas; a; a = a -> proximo) arcos++;
+        }
+        fprintf(saida, "mapa %d x %d, %ld antenas, %ld vertices, %ld ligacoes, csr %s, nefastos %s\n",
+                estado -> linhas, estado -> colunas, antenas, vertices, arcos / 2,
+                estado -> csr ? "pronto" : "por construir", estado -> nefastosValidos ? "prontos" : "por calcular");
+        resultados = 1;
+
+    } else if (strcmp(comando, "ajuda") == 0 || strcmp(comando, "help") == 0) {
+
+        fprintf(saida, "inserir F x y | remover x y | ligar x1 y1 x2 y2 | nefastos | colineares | largura x y | profundidade x y\n");
+        fprintf(saida, "caminhos x1 y1 x2 y2 [max] [segundos] | intersecoes A B | causas x y | densidade x1 y1 x2 y2\n");
+        fprintf(saida, "fecho [MB] | alcanca x1 y1 x2 y2 | analise [amostras]\n");
+        fprintf(saida, "ligacoes ficheiro | visiveis | raio R | proxima x y [F] | vizinhas x y k [F] | zona x y R [F]\n");
+        fprintf(saida, "retangulo x1 y1 x2 y2 [F] | contar x1 y1 x2 y2 [F] | ordenar [sim|nao] | estado | sair | desligar\n");
+
+    } else {
+
+        erro = "comando desconhecido (ajuda para a lista)";
+
+    }
+
+    double ms = (tempoAtual() - inicio) * 1000.0;
+    if (erro) {
+        fprintf(saida, "erro %s %.3f ms\n", erro, ms);
+    } else {
+        fprintf(saida, "ok %ld %.3f ms\n", resultados, ms);
+    }
+    fflush(saida);
+
+    return true;
+
+}
+
+/**
+ * @brief Lê e executa comandos até ao fim da entrada ou a um comando de saída.
+ *
+ * @param estado Mapa residente.
+ * @param entrada Origem dos comandos.
+ * @param saida Destino das respostas.
+ */
+
+void executarServidor(EstadoMapa *estado, FILE *entrada, FILE *saida) {
+
+    char linha[TAMANHO_LINHA];
+
+    while (fgets(linha, sizeof(linha), entrada)) {
+        if (!processarComando(estado, linha, saida)) break;
+    }
+
+}
+
+/**
+ * @brief Aceita ligações num socket Unix e serve os comandos de cada uma.
+ *
+ * As ligações são atendidas uma de cada vez; "sair" fecha a ligação atual e
+ * "desligar" termina o servidor. Um socket deixado no caminho por uma execução
+ * anterior é substituído; qualquer outro ficheiro é mantido e o servidor não arranca.
+ *
+ * @param estado Mapa residente.
+ * @param caminho Caminho do socket a criar.
+ * @return true se o servidor terminou normalmente, false se o socket não pôde ser criado
+ *         (incluindo quando o caminho já existe e não é um socket).
+ */
+
+bool executarServidorSocket(EstadoMapa *estado, const char *caminho) {
+
+#ifdef _WIN32
+    (void)estado;
+    (void)caminho;
+    return false;
+#else
+    struct sockaddr_un endereco;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        return false;
+    }
+
+    struct stat existente;
+    if (lstat(caminho, &existente) == 0) {
+        if (!S_ISSOCK(existente.st_mode)) {
+            return false;
+        }
+        unlink(caminho);
+    }
+
+    int servidor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (servidor < 0) {
+        return false;
+    }
+
+    // Um cliente que fecha a ligação a meio não deve terminar o servidor
+    signal(SIGPIPE, SIG_IGN);
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+
+    if (bind(servidor, (struct sockaddr *)&endereco, sizeof(endereco)) < 0 || listen(servidor, 8) < 0) {
+        close(servidor);
+        return false;
+    }
+
+    while (!estado -> desligar) {
+
+        int cliente = accept(servidor, NULL, NULL);
+        if (cliente < 0) continue;
+
+        int copia = dup(cliente);
+        FILE *entrada = fdopen(cliente, "r");
+        FILE *saida = copia >= 0 ? fdopen(copia, "w") : NULL;
+
+        if (entrada && saida) {
+            executarServidor(estado, entrada, saida);
+        }
+
+        if (entrada) fclose(entrada); else close(cliente);
+        if (saida) fclose(saida); else if (copia >= 0) close(copia);
+
+    }
+
+    close(servidor);
+    unlink(caminho);
+
+    return true;
+#endif
+
+}
@@ -0,0 +1,65 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file servidor.h
+ * @author Thiago Abreu
+ * @brief Modo servidor: mantém o mapa em memória e responde a comandos de texto.
+ *
+ * O mapa é carregado uma única vez; cada linha recebida (pela entrada padrão ou por
+ * um socket Unix) é um comando. As estruturas derivadas (grafo compacto e locais
+ * nefastos) ficam guardadas entre pedidos e só são recalculadas após alterações.
+ */
+
+#ifndef SERVIDOR_H
+#define SERVIDOR_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "antenas.h"
+#include "grafo.h"
+#include "grafocsr.h"
+#include "interferencia.h"
+#include "densidade.h"
+#include "kdtree.h"
+#include "regiao.h"
+#include "indice.h"
+#include "fecho.h"
+
+/**
+ * @struct EstadoMapa
+ * @brief Mapa residente e as estruturas derivadas mantidas entre pedidos.
+ */
+
+typedef struct EstadoMapa {
+    Antena *antenas;          /**< Lista de antenas */
+    Vertice *grafo;           /**< Grafo das antenas */
+    IndiceCoordenadas *indiceGrafo; /**< Vértice de cada célula, atualizado com o grafo */
+    int linhas, colunas;      /**< Dimensões do mapa */
+    GrafoCSR *csr;            /**< Grafo compacto (NULL se desatualizado) */
+    GruposFrequencia *grupos; /**< Vértices do grafo compacto por frequência (NULL se desatualizado) */
+    FechoTransitivo *fecho;   /**< Alcance entre todos os pares (NULL se desatualizado) */
+    Coordenada *nefastos;     /**< Locais nefastos calculados */
+    bool nefastosValidos;     /**< true se `nefastos` corresponde às antenas atuais */
+    Coordenada *colineares;   /**< Locais nefastos no modo colinear */
+    bool colinearesValidos;   /**< true se `colineares` corresponde às antenas atuais */
+    IndiceInterferencia *interferencia; /**< Causas dos locais nefastos (NULL se desatualizado) */
+    GrelhaInterferencia *densidade;     /**< Contagens por célula (NULL se desatualizada) */
+    ArvoreKD *proximidade;    /**< Árvore k-d das antenas (NULL até à primeira procura) */
+    IndiceRegioes *regioes;   /**< Índice de regiões das antenas (NULL até à primeira consulta) */
+    bool saidaOrdenada;       /**< true se as listas de resultados saem ordenadas por (x, y) */
+    bool desligar;            /**< Pedido de paragem do servidor */
+} EstadoMapa;
+
+bool carregarEstadoMapa(EstadoMapa *estado, const char *nomeFicheiro);
+void libertarEstadoMapa(EstadoMapa *estado);
+bool processarComando(EstadoMapa *estado, const char *linha, FILE *saida);
+void executarServidor(EstadoMapa *estado, FILE *entrada, FILE *saida);
+bool executarServidorSocket(EstadoMapa *estado, const char *caminho);
+
+#endif
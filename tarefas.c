@@ -0,0 +1,714 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file tarefas.c
+ * @author Thiago Abreu
+ * @brief Implementação do conjunto de threads com roubo de trabalho.
+ *
+ * Cada fila dupla é um vetor protegido pelo seu próprio trinco: a dona empilha e
+ * desempilha no fim (ordem LIFO, boa localidade), as ladras retiram do início
+ * (as tarefas mais antigas, normalmente as maiores). Uma thread sem trabalho
+ * adormece até ser submetida uma nova tarefa.
+ *
+ * Uma thread que espera por um grupo de tarefas não fica parada: executa tarefas
+ * das filas até o grupo terminar, o que permite esperas encadeadas dentro de tarefas.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "tarefas.h"
+
+/** Capacidade inicial de cada fila dupla. */
+#define CAPACIDADE_INICIAL_FILA 64
+
+/** Número de threads do conjunto global quando não é possível consultar o sistema. */
+#define THREADS_GLOBAIS_PADRAO 4
+
+/**
+ * @struct Tarefa
+ * @brief Uma função a executar e o seu argumento.
+ */
+
+typedef struct Tarefa {
+    FuncaoTarefa funcao;   /**< Função a executar */
+    void *arg;             /**< Argumento passado à função */
+    GrupoTarefas *grupo;   /**< Grupo a que pertence (ou NULL) */
+} Tarefa;
+
+/**
+ * @struct FilaDupla
+ * @brief Fila dupla de tarefas de uma thread; as tarefas ocupam [inicio, fim).
+ */
+
+typedef struct FilaDupla {
+    pthread_mutex_t trinco;  /**< Protege a fila */
+    Tarefa *itens;           /**< Vetor de tarefas */
+    int capacidade;          /**< Capacidade do vetor */
+    int inicio;              /**< Primeira tarefa (lado das ladras) */
+    int fim;                 /**< Posição a seguir à última tarefa (lado da dona) */
+} FilaDupla;
+
+/**
+ * @struct TrabalhadorPool
+ * @brief Identificação de uma thread do conjunto.
+ */
+
+typedef struct TrabalhadorPool {
+    PoolTarefas *pool;  /**< Conjunto a que pertence */
+    int id;             /**< Índice da thread e da sua fila */
+} TrabalhadorPool;
+
+/**
+ * @struct PoolTarefas
+ * @brief Estado partilhado do conjunto de threads.
+ */
+
+struct PoolTarefas {
+    int numThreads;                  /**< Número de threads trabalhadoras */
+    int numFilas;                    /**< Número de filas duplas inicializadas */
+    pthread_t *threads;              /**< Threads criadas */
+    TrabalhadorPool *trabalhadores;  /**< Identificação de cada thread */
+    FilaDupla *filas;                /**< Uma fila dupla por thread */
+    pthread_mutex_t trinco;          /**< Protege o adormecer e o acordar das threads */
+    pthread_cond_t haTrabalho;       /**< Sinaliza novas tarefas */
+    pthread_cond_t concluido;        /**< Sinaliza que não restam tarefas pendentes */
+    _Atomic int porIniciar;          /**< Tarefas nas filas ainda não iniciadas */
+    _Atomic int pendentes;           /**< Tarefas submetidas ainda não concluídas */
+    _Atomic unsigned proximaFila;    /**< Fila de destino das submissões externas */
+    bool terminar;                   /**< Indica às threads que devem sair */
+};
+
+/**
+ * @struct IntervaloPara
+ * @brief Parte de um `paraleloPara` ainda por executar.
+ */
+
+typedef struct IntervaloPara {
+    FuncaoIntervalo funcao;  /**< Função aplicada ao intervalo */
+    void *arg;               /**< Argumento passado à função */
+    int inicio, fim;         /**< Intervalo [inicio, fim) */
+    int grao;                /**< Tamanho abaixo do qual o intervalo não é dividido */
+    GrupoTarefas *grupo;     /**< Grupo de todas as partes do ciclo */
+} IntervaloPara;
+
+/** Conjunto e fila da thread atual, quando é uma trabalhadora. */
+static _Thread_local PoolTarefas *poolAtual = NULL;
+static _Thread_local int filaAtual = -1;
+
+/** Conjunto global partilhado pelas análises. */
+static PoolTarefas *poolPartilhado = NULL;
+static int threadsGlobais = 0;
+static pthread_mutex_t trincoGlobal = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Acrescenta uma tarefa no fim de uma fila dupla.
+ *
+ * @param f Fila dupla.
+ * @param t Tarefa a acrescentar.
+ * @return true se a tarefa foi acrescentada, false em caso de falha de memória.
+ */
+
+static bool empilharFila(FilaDupla *f, Tarefa t) {
+
+    pthread_mutex_lock(&f -> trinco);
+
+    if (f -> fim == f -> capacidade) {
+
+        int usados = f -> fim - f -> inicio;
+
+        if (f -> inicio > f -> capacidade / 2) {
+            // Reaproveita o espaço libertado pelas ladras
+            for (int i = 0; i < usados; i++) {
+                f -> itens[i] = f -> itens[f -> inicio + i];
+            }
+        } else {
+            Tarefa *novos = (Tarefa *)realloc(f -> itens, 2 * f -> capacidade * sizeof(Tarefa));
+            if (!novos) {
+                pthread_mutex_unlock(&f -> trinco);
+                return false;
+            }
+            f -> itens = novos;
+            f -> capacidade *= 2;
+            for (int i = 0; i < usados; i++) {
+                f -> itens[i] = f -> itens[f -> inicio + i];
+            }
+        }
+
+        f -> inicio = 0;
+        f -> fim = usados;
+
+    }
+
+    f -> itens[f -> fim++] = t;
+    pthread_mutex_unlock(&f -> trinco);
+
+    return true;
+
+}
+
+/**
+ * @brief Retira uma tarefa de uma fila dupla, pelo fim (dona) ou pelo início (ladra).
+ *
+ * @param f Fila dupla.
+ * @param peloFim true para retirar a tarefa mais recente.
+ * @param t Destino da tarefa retirada.
+ * @return true se foi retirada uma tarefa.
+ */
+
+static bool retirarFila(FilaDupla *f, bool peloFim, Tarefa *t) {
+
+    pthread_mutex_lock(&f -> trinco);
+
+    if (f -> inicio == f -> fim) {
+        pthread_mutex_unlock(&f -> trinco);
+        return false;
+    }
+
+    if (peloFim) {
+        *t = f -> itens[--f -> fim];
+    } else {
+        *t = f -> itens[f -> inicio++];
+    }
+
+    if (f -> inicio == f -> fim) {
+        f -> inicio = f -> fim = 0;
+    }
+
+    pthread_mutex_unlock(&f -> trinco);
+
+    return true;
+
+}
+
+/**
+ * @brief Obtém a próxima tarefa para uma thread: primeiro da própria fila, depois roubando.
+ *
+ * @param pool Conjunto de threads.
+ * @param id Fila da thread, ou -1 se a thread não pertence ao conjunto.
+ * @param t Destino da tarefa obtida.
+ * @return true se foi obtida uma tarefa.
+ */
+
+static bool obterTarefa(PoolTarefas *pool, int id, Tarefa *t) {
+
+    if (id >= 0 && retirarFila(&pool -> filas[id], true, t)) {
+        atomic_fetch_sub(&pool -> porIniciar, 1);
+        return true;
+    }
+
+    int n = pool -> numThreads;
+    int partida = id >= 0 ? id + 1 : (int)(atomic_load(&pool -> proximaFila) % n);
+
+    for (int k = 0; k < n; k++) {
+
+        int vitima = (partida + k) % n;
+        if (vitima == id) continue;
+
+        if (retirarFila(&pool -> filas[vitima], false, t)) {
+            atomic_fetch_sub(&pool -> porIniciar, 1);
+            return true;
+        }
+
+    }
+
+    return false;
+
+}
+
+/**
+ * @brief Executa uma tarefa e regista a sua conclusão.
+ *
+ * @param pool Conjunto de threads.
+ * @param t Tarefa a executar.
+ */
+
+static void executarTarefa(PoolTarefas *pool, Tarefa t) {
+
+    t.funcao(t.arg);
+
+    if (t.grupo && atomic_fetch_sub(&t.grupo -> pendentes, 1) == 1) {
+        pthread_mutex_lock(&pool -> trinco);
+        pthread_cond_broadcast(&pool -> concluido);
+        pthread_mutex_unlock(&pool -> trinco);
+    }
+
+    if (atomic_fetch_sub(&pool -> pendentes, 1) == 1) {
+        pthread_mutex_lock(&pool -> trinco);
+        pthread_cond_broadcast(&pool -> concluido);
+        pthread_mutex_unlock(&pool -> trinco);
+    }
+
+}
+
+/**
+ * @brief Ciclo de uma thread trabalhadora.
+ *
+ * @param arg Apontador para o TrabalhadorPool da thread.
+ * @return NULL.
+ */
+
+static void *trabalhar(void *arg) {
+
+    TrabalhadorPool *w = (TrabalhadorPool *)arg;
+    PoolTarefas *pool = w -> pool;
+    poolAtual = pool;
+    filaAtual = w -> id;
+
+    while (true) {
+
+        Tarefa t;
+        if (obterTarefa(pool, w -> id, &t)) {
+            executarTarefa(pool, t);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool -> trinco);
+        while (!pool -> terminar && atomic_load(&pool -> porIniciar) == 0) {
+            pthread_cond_wait(&pool -> haTrabalho, &pool -> trinco);
+        }
+        bool sair = pool -> terminar && atomic_load(&pool -> porIniciar) == 0;
+        pthread_mutex_unlock(&pool -> trinco);
+
+        if (sair) break;
+
+    }
+
+    return NULL;
+
+}
+
+/**
+ * @brief Cria um conjunto de threads trabalhadoras.
+ *
+ * @param numThreads Número de threads (valores inferiores a 1 contam como 1).
+ * @return Conjunto criado, ou false em caso de erro.
+ */
+
+PoolTarefas *criarPoolTarefas(int numThreads) {
+
+    if (numThreads < 1) numThreads = 1;
+
+    PoolTarefas *pool = (PoolTarefas *)calloc(1, sizeof(PoolTarefas));
+    if (!pool) {
+        return false;
+    }
+
+    pool -> threads = (pthread_t *)malloc(numThreads * sizeof(pthread_t));
+    pool -> trabalhadores = (TrabalhadorPool *)malloc(numThreads * sizeof(TrabalhadorPool));
+    pool -> filas = (FilaDupla *)calloc(numThreads, sizeof(FilaDupla));
+
+    if (!pool -> threads || !pool -> trabalhadores || !pool -> filas) {
+        free(pool -> threads);
+        free(pool -> trabalhadores);
+        free(pool -> filas);
+        free(pool);
+        return false;
+    }
+
+    pthread_mutex_init(&pool -> trinco, NULL);
+    pthread_cond_init(&pool -> haTrabalho, NULL);
+    pthread_cond_init(&pool -> concluido, NULL);
+
+    pool -> numFilas = numThreads;
+    for (int i = 0; i < numThreads; i++) {
+        pthread_mutex_init(&pool -> filas[i].trinco, NULL);
+        pool -> filas[i].itens = (Tarefa *)malloc(CAPACIDADE_INICIAL_FILA * sizeof(Tarefa));
+        pool -> filas[i].capacidade = pool -> filas[i].itens ? CAPACIDADE_INICIAL_FILA : 0;
+    }
+
+    // As filas existem todas antes de qualquer thread começar a roubar
+    pool -> numThreads = numThreads;
+    for (int i = 0; i < numThreads; i++) {
+
+        pool -> trabalhadores[i].pool = pool;
+        pool -> trabalhadores[i].id = i;
+
+        if (!pool -> filas[i].itens ||
+            pthread_create(&pool -> threads[i], NULL, trabalhar, &pool -> trabalhadores[i]) != 0) {
+            pool -> numThreads = i;
+            break;
+        }
+
+    }
+
+    if (pool -> numThreads == 0) {
+        return libertarPoolTarefas(pool);
+    }
+
+    return pool;
+
+}
+
+/**
+ * @brief Indica quantas threads trabalhadoras o conjunto tem.
+ *
+ * @param pool Conjunto de threads.
+ * @return Número de threads, ou 0 se o conjunto for inválido.
+ */
+
+int numThreadsPool(const PoolTarefas *pool) {
+
+    return pool ? pool -> numThreads : 0;
+
+}
+
+/**
+ * @brief Coloca uma tarefa numa fila do conjunto e acorda uma thread.
+ *
+ * Quando chamada a partir de uma tarefa em execução, a nova tarefa vai para a fila
+ * da própria thread; caso contrário é distribuída pelas filas em rotação.
+ *
+ * @param pool Conjunto de threads.
+ * @param t Tarefa a submeter.
+ * @return true se a tarefa foi submetida, false em caso de erro.
+ */
+
+static bool submeter(PoolTarefas *pool, Tarefa t) {
+
+    int id = poolAtual == pool ? filaAtual : (int)(atomic_fetch_add(&pool -> proximaFila, 1) % pool -> numThreads);
+
+    atomic_fetch_add(&pool -> pendentes, 1);
+    if (t.grupo) atomic_fetch_add(&t.grupo -> pendentes, 1);
+
+    if (!empilharFila(&pool -> filas[id], t)) {
+        if (t.grupo) atomic_fetch_sub(&t.grupo -> pendentes, 1);
+        atomic_fetch_sub(&pool -> pendentes, 1);
+        return false;
+    }
+
+    pthread_mutex_lock(&pool -> trinco);
+    atomic_fetch_add(&pool -> porIniciar, 1);
+    pthread_cond_signal(&pool -> haTrabalho);
+    pthread_mutex_unlock(&pool -> trinco);
+
+    return true;
+
+}
+
+/**
+ * @brief Submete uma tarefa ao conjunto, fora de qualquer grupo.
+ *
+ * @param pool Conjunto de threads.
+ * @param funcao Função a executar.
+ * @param arg Argumento passado à função.
+ * @return true se a tarefa foi submetida, false em caso de erro.
+ */
+
+bool submeterTarefa(PoolTarefas *pool, FuncaoTarefa funcao, void *arg) {
+
+    if (!pool || !funcao) {
+        return false;
+    }
+
+    Tarefa t = { funcao, arg, NULL };
+    return submeter(pool, t);
+
+}
+
+/**
+ * @brief Espera que todas as tarefas submetidas (e as que estas criarem) terminem.
+ *
+ * A thread que espera também executa tarefas enquanto houver trabalho disponível.
+ * Não deve ser chamada a partir de uma tarefa do próprio conjunto.
+ *
+ * @param pool Conjunto de threads.
+ */
+
+void aguardarTarefas(PoolTarefas *pool) {
+
+    if (!pool) return;
+
+    while (atomic_load(&pool -> pendentes) > 0) {
+
+        Tarefa t;
+        if (obterTarefa(pool, -1, &t)) {
+            executarTarefa(pool, t);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool -> trinco);
+        while (atomic_load(&pool -> pendentes) > 0 && atomic_load(&pool -> porIniciar) == 0) {
+            pthread_cond_wait(&pool -> concluido, &pool -> trinco);
+        }
+        pthread_mutex_unlock(&pool -> trinco);
+
+    }
+
+}
+
+/**
+ * @brief Termina as threads e liberta o conjunto.
+ *
+ * As tarefas ainda nas filas são executadas antes de as threads saírem.
+ *
+ * @param pool Conjunto de threads.
+ * @return false após a libertação completa.
+ */
+
+PoolTarefas *libertarPoolTarefas(PoolTarefas *pool) {
+
+    if (!pool) {
+        return false;
+    }
+
+    pthread_mutex_lock(&pool -> trinco);
+    pool -> terminar = true;
+    pthread_cond_broadcast(&pool -> haTrabalho);
+    pthread_mutex_unlock(&pool -> trinco);
+
+    for (int i = 0; i < pool -> numThreads; i++) {
+        pthread_join(pool -> threads[i], NULL);
+    }
+
+    for (int i = 0; i < pool -> numFilas; i++) {
+        pthread_mutex_destroy(&pool -> filas[i].trinco);
+        free(pool -> filas[i].itens);
+    }
+
+    pthread_mutex_destroy(&pool -> trinco);
+    pthread_cond_destroy(&pool -> haTrabalho);
+    pthread_cond_destroy(&pool -> concluido);
+    free(pool -> threads);
+    free(pool -> trabalhadores);
+    free(pool -> filas);
+    free(pool);
+
+    return false;
+
+}
+
+/**
+ * @brief Prepara um grupo de tarefas vazio.
+ *
+ * @param grupo Grupo a iniciar.
+ * @param pool Conjunto onde as tarefas do grupo serão executadas (NULL executa-as de imediato).
+ */
+
+void iniciarGrupo(GrupoTarefas *grupo, PoolTarefas *pool) {
+
+    grupo -> pool = pool;
+    atomic_init(&grupo -> pendentes, 0);
+
+}
+
+/**
+ * @brief Submete uma tarefa pertencente a um grupo.
+ *
+ * Se o grupo não tiver conjunto de threads, a tarefa é executada na thread que a submete.
+ *
+ * @param grupo Grupo da tarefa.
+ * @param funcao Função a executar.
+ * @param arg Argumento passado à função.
+ * @return true se a tarefa foi submetida ou executada, false em caso de erro.
+ */
+
+bool submeterGrupo(GrupoTarefas *grupo, FuncaoTarefa funcao, void *arg) {
+
+    if (!grupo || !funcao) {
+        return false;
+    }
+
+    if (!grupo -> pool) {
+        funcao(arg);
+        return true;
+    }
+
+    Tarefa t = { funcao, arg, grupo };
+    return submeter(grupo -> pool, t);
+
+}
+
+/**
+ * @brief Espera que todas as tarefas de um grupo terminem.
+ *
+ * Enquanto espera, a thread executa tarefas do conjunto (do grupo ou não), pelo
+ * que pode ser chamada dentro de uma tarefa sem bloquear uma thread trabalhadora.
+ *
+ * @param grupo Grupo a esperar.
+ */
+
+void aguardarGrupo(GrupoTarefas *grupo) {
+
+    if (!grupo || !grupo -> pool) return;
+
+    PoolTarefas *pool = grupo -> pool;
+    int id = poolAtual == pool ? filaAtual : -1;
+
+    while (atomic_load(&grupo -> pendentes) > 0) {
+
+        Tarefa t;
+        if (obterTarefa(pool, id, &t)) {
+            executarTarefa(pool, t);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool -> trinco);
+        while (atomic_load(&grupo -> pendentes) > 0 && atomic_load(&pool -> porIniciar) == 0) {
+            pthread_cond_wait(&pool -> concluido, &pool -> trinco);
+        }
+        pthread_mutex_unlock(&pool -> trinco);
+
+    }
+
+}
+
+/**
+ * @brief Executa uma parte de um `paraleloPara`, dividindo-a enquanto for maior que o grão.
+ *
+ * A metade direita de cada divisão fica disponível para ser roubada por outra thread.
+ *
+ * @param arg Apontador para o IntervaloPara (libertado no fim).
+ */
+
+static void executarIntervalo(void *arg) {
+
+    IntervaloPara *iv = (IntervaloPara *)arg;
+    int inicio = iv -> inicio, fim = iv -> fim;
+
+    while (fim - inicio > iv -> grao) {
+
+        int meio = inicio + (fim - inicio) / 2;
+
+        IntervaloPara *direita = (IntervaloPara *)malloc(sizeof(IntervaloPara));
+        if (!direita) break;
+
+        *direita = *iv;
+        direita -> inicio = meio;
+        direita -> fim = fim;
+
+        if (!submeterGrupo(iv -> grupo, executarIntervalo, direita)) {
+            free(direita);
+            break;
+        }
+
+        fim = meio;
+
+    }
+
+    iv -> funcao(inicio, fim, iv -> arg);
+    free(iv);
+
+}
+
+/**
+ * @brief Aplica uma função a todos os índices de [inicio, fim), repartidos pelas threads.
+ *
+ * O intervalo é dividido ao meio recursivamente até partes de `grao` índices; a thread
+ * que chama participa e só regressa quando todas as partes terminarem.
+ *
+ * @param pool Conjunto de threads (NULL executa tudo na thread atual).
+ * @param inicio Primeiro índice.
+ * @param fim Índice a seguir ao último.
+ * @param grao Tamanho mínimo de cada parte (valores inferiores a 1 contam como 1).
+ * @param funcao Função chamada para cada parte.
+ * @param arg Argumento passado à função.
+ */
+
+void paraleloPara(PoolTarefas *pool, int inicio, int fim, int grao, FuncaoIntervalo funcao, void *arg) {
+
+    if (!funcao || fim <= inicio) return;
+    if (grao < 1) grao = 1;
+
+    IntervaloPara *raiz = pool ? (IntervaloPara *)malloc(sizeof(IntervaloPara)) : NULL;
+    if (!raiz) {
+        funcao(inicio, fim, arg);
+        return;
+    }
+
+    GrupoTarefas grupo;
+    iniciarGrupo(&grupo, pool);
+
+    raiz -> funcao = funcao;
+    raiz -> arg = arg;
+    raiz -> inicio = inicio;
+    raiz -> fim = fim;
+    raiz -> grao = grao;
+    raiz -> grupo = &grupo;
+
+    executarIntervalo(raiz);
+    aguardarGrupo(&grupo);
+
+}
+
+/**
+ * @brief Número de processadores disponíveis no sistema.
+ *
+ * @return Número de processadores, ou THREADS_GLOBAIS_PADRAO se não for possível saber.
+ */
+
+static int numProcessadores(void) {
+
+#ifndef _WIN32
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 0) return (int)n;
+#endif
+
+    return THREADS_GLOBAIS_PADRAO;
+
+}
+
+/**
+ * @brief Define o número de threads do conjunto global.
+ *
+ * Se o conjunto já existir com outro número de threads, é recriado na próxima utilização.
+ * Não deve ser chamada enquanto houver tarefas em curso no conjunto global.
+ *
+ * @param numThreads Número de threads (0 ou negativo usa o número de processadores).
+ */
+
+void definirNumThreadsGlobal(int numThreads) {
+
+    pthread_mutex_lock(&trincoGlobal);
+
+    threadsGlobais = numThreads > 0 ? numThreads : 0;
+    if (poolPartilhado && threadsGlobais > 0 && numThreadsPool(poolPartilhado) != threadsGlobais) {
+        poolPartilhado = libertarPoolTarefas(poolPartilhado);
+    }
+
+    pthread_mutex_unlock(&trincoGlobal);
+
+}
+
+/**
+ * @brief Obtém o conjunto de threads partilhado, criando-o na primeira utilização.
+ *
+ * @return Conjunto global, ou false se não puder ser criado.
+ */
+
+PoolTarefas *poolGlobal(void) {
+
+    pthread_mutex_lock(&trincoGlobal);
+
+    if (!poolPartilhado) {
+        poolPartilhado = criarPoolTarefas(threadsGlobais > 0 ? threadsGlobais : numProcessadores());
+    }
+
+    PoolTarefas *pool = poolPartilhado;
+    pthread_mutex_unlock(&trincoGlobal);
+
+    return pool;
+
+}
+
+/**
+ * @brief Termina as threads do conjunto global.
+ */
+
+void libertarPoolGlobal(void) {
+
+    pthread_mutex_lock(&trincoGlobal);
+    poolPartilhado = libertarPoolTarefas(poolPartilhado);
+    pthread_mutex_unlock(&trincoGlobal);
+
+}
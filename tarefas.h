@@ -0,0 +1,63 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file tarefas.h
+ * @author Thiago Abreu
+ * @brief Conjunto de threads com roubo de trabalho (work stealing).
+ *
+ * Cada thread tem a sua própria fila dupla de tarefas: retira do fim as tarefas
+ * que ela própria criou e, quando fica sem trabalho, rouba do início das filas
+ * das outras threads. Há um conjunto global, partilhado por todas as análises,
+ * cujo número de threads é escolhido na linha de comandos.
+ */
+
+#ifndef TAREFAS_H
+#define TAREFAS_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/** Função executada por uma tarefa. */
+typedef void (*FuncaoTarefa)(void *arg);
+
+/** Função aplicada a um intervalo [inicio, fim) de índices por `paraleloPara`. */
+typedef void (*FuncaoIntervalo)(int inicio, int fim, void *arg);
+
+/** Conjunto de threads trabalhadoras (estrutura opaca). */
+typedef struct PoolTarefas PoolTarefas;
+
+/**
+ * @struct GrupoTarefas
+ * @brief Conjunto de tarefas relacionadas que podem ser esperadas em bloco.
+ *
+ * Permite que várias análises partilhem o mesmo conjunto de threads: cada uma
+ * espera apenas pelas suas tarefas.
+ */
+
+typedef struct GrupoTarefas {
+    PoolTarefas *pool;      /**< Conjunto onde as tarefas são executadas */
+    _Atomic int pendentes;  /**< Tarefas do grupo ainda não concluídas */
+} GrupoTarefas;
+
+PoolTarefas *criarPoolTarefas(int numThreads);
+int numThreadsPool(const PoolTarefas *pool);
+bool submeterTarefa(PoolTarefas *pool, FuncaoTarefa funcao, void *arg);
+void aguardarTarefas(PoolTarefas *pool);
+PoolTarefas *libertarPoolTarefas(PoolTarefas *pool);
+
+void iniciarGrupo(GrupoTarefas *grupo, PoolTarefas *pool);
+bool submeterGrupo(GrupoTarefas *grupo, FuncaoTarefa funcao, void *arg);
+void aguardarGrupo(GrupoTarefas *grupo);
+void paraleloPara(PoolTarefas *pool, int inicio, int fim, int grao, FuncaoIntervalo funcao, void *arg);
+
+void definirNumThreadsGlobal(int numThreads);
+PoolTarefas *poolGlobal(void);
+void libertarPoolGlobal(void);
+
+#endif
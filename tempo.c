@@ -0,0 +1,40 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file tempo.c
+ * @author Thiago Abreu
+ * @brief Implementação da medição de tempo com relógio monotónico.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include "tempo.h"
+
+/**
+ * @brief Obtém o instante atual em segundos.
+ *
+ * Só a diferença entre dois valores tem significado. Em sistemas POSIX usa o
+ * relógio monotónico; no Windows recorre a `timespec_get`.
+ *
+ * @return Instante atual em segundos, com resolução de nanossegundos.
+ */
+
+double tempoAtual(void) {
+
+    struct timespec t;
+
+#ifdef _WIN32
+    timespec_get(&t, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &t);
+#endif
+
+    return (double)t.tv_sec + (double)t.tv_nsec / 1e9;
+
+}
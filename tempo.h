@@ -0,0 +1,20 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file tempo.h
+ * @author Thiago Abreu
+ * @brief Medição de tempo para benchmarks e limites de execução.
+ */
+
+#ifndef TEMPO_H
+#define TEMPO_H
+
+double tempoAtual(void);
+
+#endif
@@ -0,0 +1,1816 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+/**
+ * @file verificacao.c
+ * @author Thiago Abreu
+ * @brief Implementação da verificação diferencial.
+ *
+ * Cada caso gera um mapa de antenas e um grafo pequenos (as referências das
+ * procuras em profundidade e dos caminhos têm custo exponencial) a partir de uma
+ * semente derivada do caso, pelo que qualquer divergência é reproduzível com a
+ * semente indicada no relatório.
+ *
+ * Os caminhos são comparados pela união dos vértices de todos os caminhos:
+ * `caminhosEntreAntenas` devolve essa união com um marcador (0, 0) acrescentado por
+ * `copiarCaminho`, que é retirado dos dois lados antes da comparação.
+ *
+ * As restantes estruturas são verificadas por funções isoladas, reunidas na
+ * tabela `verificacoes`: cada uma recebe os parâmetros sorteados do caso e gera
+ * os seus próprios dados, pelo que uma estrutura nova só acrescenta a sua
+ * função e uma entrada na tabela.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "verificacao.h"
+#include "funcoes.h"
+#include "gerador.h"
+#include "grafocsr.h"
+#include "procuras.h"
+#include "caminhos.h"
+#include "nefastos.h"
+#include "interferencia.h"
+#include "densidade.h"
+#include "ligacoes.h"
+#include "kdtree.h"
+#include "regiao.h"
+#include "fecho.h"
+#include "analise.h"
+#include "frequencias.h"
+#include "compacto.h"
+#include "ordenacao.h"
+#include "lote.h"
+#include "tempo.h"
+
+/** Número máximo de divergências descritas individualmente. */
+#define MAX_DIVERGENCIAS_DESCRITAS 10
+
+/** Consultas de cada ficheiro de lote gerado. */
+#define CONSULTAS_LOTE 12
+
+/** Ficheiros temporários da verificação do lote, na pasta atual. */
+#define FICHEIRO_CONSULTAS_VERIFICACAO "verificacao_consultas.tmp"
+#define FICHEIRO_RESULTADOS_VERIFICACAO "verificacao_resultados.tmp"
+
+/**
+ * @enum Motor
+ * @brief Pares (referência, otimizada) verificados.
+ */
+
+typedef enum Motor {
+    MOTOR_NEFASTOS,
+    MOTOR_INTERFERENCIA,
+    MOTOR_NEFASTOS_COMPACTO,
+    MOTOR_LARGURA_PARALELA,
+    MOTOR_LARGURA_MULTIPLA,
+    MOTOR_LARGURA_HILBERT,
+    MOTOR_PROFUNDIDADE,
+    MOTOR_CAMINHOS,
+    MOTOR_CAMINHOS_LIMITE,
+    MOTOR_ORDENACAO,
+    NUM_MOTORES
+} Motor;
+
+/** Nomes dos pares verificados, pela ordem de `Motor`. */
+static const char *nomesMotores[NUM_MOTORES] = {
+    "nefastos (paralela)",
+    "nefastos (indice)",
+    "nefastos (compacta)",
+    "largura (paralela)",
+    "largura (em lote)",
+    "largura (Hilbert)",
+    "profundidade (CSR)",
+    "caminhos (paralela)",
+    "caminhos (limite)",
+    "ordenacao (radix)"
+};
+
+/**
+ * @struct ResultadoMotor
+ * @brief Totais acumulados de um par verificado.
+ */
+
+typedef struct ResultadoMotor {
+    long casos;             /**< Comparações feitas */
+    long divergencias;      /**< Comparações com resultados diferentes */
+    double tempoReferencia; /**< Tempo total da referência */
+    double tempoOtimizado;  /**< Tempo total da versão otimizada */
+} ResultadoMotor;
+
+/**
+ * @struct ConjuntoPosicoes
+ * @brief Conjunto de coordenadas ordenado, para comparação.
+ */
+
+typedef struct ConjuntoPosicoes {
+    long tamanho;     /**< Número de posições distintas */
+    long long *chaves; /**< Posições codificadas e ordenadas */
+} ConjuntoPosicoes;
+
+/**
+ * @struct CasoVerificacao
+ * @brief Parâmetros sorteados de um caso, partilhados pelas verificações isoladas.
+ */
+
+typedef struct CasoVerificacao {
+    unsigned int semente;  /**< Semente do caso (indicada nas divergências) */
+    unsigned int sorteio;  /**< Valor derivado da semente, origem das restantes escolhas */
+    ParametrosMapa mapa;   /**< Mapa de antenas do caso */
+    int numVertices;       /**< Vértices do grafo do caso */
+    int numFrequencias;    /**< Frequências do grafo do caso */
+    int grau;              /**< Grau médio do grafo do caso */
+} CasoVerificacao;
+
+/**
+ * @brief Verificação isolada: gera os dados a partir do caso e compara as duas versões.
+ *
+ * Devolve true se os resultados coincidirem e preenche os tempos da referência
+ * e da versão otimizada.
+ */
+
+typedef bool (*FuncaoVerificacao)(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado);
+
+/**
+ * @struct Verificacao
+ * @brief Entrada da tabela de verificações isoladas.
+ */
+
+typedef struct Verificacao {
+    const char *nome;            /**< Nome no relatório */
+    FuncaoVerificacao verificar; /**< Função que executa a verificação */
+} Verificacao;
+
+/**
+ * @struct Retangulo
+ * @brief Cantos de um retângulo de consulta, por qualquer ordem.
+ */
+
+typedef struct Retangulo {
+    int x1, y1; /**< Primeiro canto */
+    int x2, y2; /**< Canto oposto */
+} Retangulo;
+
+/**
+ * @struct AlteracaoAntena
+ * @brief Inserção ou remoção sorteada, já aplicada à lista de antenas.
+ */
+
+typedef struct AlteracaoAntena {
+    bool insercao;          /**< true para uma inserção, false para uma remoção */
+    bool efetiva;           /**< true se a lista foi alterada */
+    Frequencia frequencia;  /**< Frequência da antena inserida */
+    int x, y;               /**< Posição alterada */
+} AlteracaoAntena;
+
+/**
+ * @brief Codifica uma coordenada numa chave ordenável por (x, y).
+ *
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Chave da coordenada.
+ */
+
+static long long chavePosicao(int x, int y) {
+
+    // Deslocamento sem sinal: as verificações de regiões usam coordenadas negativas
+    return (long long)((unsigned long long)x << 32) | (unsigned int)y;
+
+}
+
+/**
+ * @brief Compara duas chaves, para `qsort`.
+ *
+ * @param a Primeira chave.
+ * @param b Segunda chave.
+ * @return Negativo, zero ou positivo.
+ */
+
+static int compararChaves(const void *a, const void *b) {
+
+    long long p = *(const long long *)a, q = *(const long long *)b;
+
+    return (p > q) - (p < q);
+
+}
+
+/**
+ * @brief Ordena e retira repetidos de um vetor de chaves.
+ *
+ * @param c Conjunto cujas `tamanho` chaves já estão preenchidas.
+ */
+
+static void normalizarConjunto(ConjuntoPosicoes *c) {
+
+    qsort(c -> chaves, c -> tamanho, sizeof(long long), compararChaves);
+
+    long k = 0;
+    for (long i = 0; i < c -> tamanho; i++) {
+        if (k == 0 || c -> chaves[i] != c -> chaves[k - 1]) c -> chaves[k++] = c -> chaves[i];
+    }
+    c -> tamanho = k;
+
+}
+
+/**
+ * @brief Constrói um conjunto a partir de uma lista de coordenadas.
+ *
+ * @param lista Lista de coordenadas.
+ * @param semMarcador true para ignorar a posição (0, 0).
+ * @return Conjunto construído (vazio em caso de falha de memória).
+ */
+
+static ConjuntoPosicoes conjuntoLista(Coordenada *lista, bool semMarcador) {
+
+    ConjuntoPosicoes c = { 0, NULL };
+
+    long n = 0;
+    for (Coordenada *p = lista; p; p = p -> proximo) n++;
+
+    c.chaves = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (!c.chaves) {
+        return c;
+    }
+
+    for (Coordenada *p = lista; p; p = p -> proximo) {
+        if (semMarcador && p -> x == 0 && p -> y == 0) continue;
+        c.chaves[c.tamanho++] = chavePosicao(p -> x, p -> y);
+    }
+
+    normalizarConjunto(&c);
+
+    return c;
+
+}
+
+/**
+ * @brief Copia as chaves de uma lista pela ordem em que aparecem, sem ordenar.
+ *
+ * @param lista Lista de coordenadas.
+ * @return Sequência de chaves (vazia em caso de falha de memória).
+ */
+
+static ConjuntoPosicoes sequenciaLista(Coordenada *lista) {
+
+    ConjuntoPosicoes c = { 0, NULL };
+
+    long n = 0;
+    for (Coordenada *p = lista; p; p = p -> proximo) n++;
+
+    c.chaves = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (!c.chaves) {
+        return c;
+    }
+
+    for (Coordenada *p = lista; p; p = p -> proximo) {
+        c.chaves[c.tamanho++] = chavePosicao(p -> x, p -> y);
+    }
+
+    return c;
+
+}
+
+/**
+ * @brief Constrói o conjunto de vértices alcançados numa tabela de distâncias.
+ *
+ * @param g Grafo compacto.
+ * @param d Tabela de distâncias.
+ * @param indiceOrigem Origem da tabela a considerar.
+ * @return Conjunto construído.
+ */
+
+static ConjuntoPosicoes conjuntoDistancias(const GrafoCSR *g, const DistanciasLargura *d, int indiceOrigem) {
+
+    ConjuntoPosicoes c = { 0, NULL };
+
+    c.chaves = (long long *)malloc((g -> numVertices > 0 ? g -> numVertices : 1) * sizeof(long long));
+    if (!c.chaves || !d) {
+        return c;
+    }
+
+    for (int v = 0; v < g -> numVertices; v++) {
+        if (distanciaLargura(d, indiceOrigem, v) >= 0) c.chaves[c.tamanho++] = chavePosicao(g -> x[v], g -> y[v]);
+    }
+
+    normalizarConjunto(&c);
+
+    return c;
+
+}
+
+/**
+ * @brief Constrói o conjunto dos vértices que aparecem em algum caminho.
+ *
+ * @param g Grafo compacto.
+ * @param l Caminhos encontrados.
+ * @return Conjunto construído, sem a posição (0, 0).
+ */
+
+static ConjuntoPosicoes conjuntoCaminhos(const GrafoCSR *g, const ListaCaminhos *l) {
+
+    ConjuntoPosicoes c = { 0, NULL };
+    long n = l ? l -> inicioCaminho[l -> numCaminhos] : 0;
+
+    c.chaves = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (!c.chaves) {
+        return c;
+    }
+
+    for (long k = 0; k < n; k++) {
+        int v = l -> vertices[k];
+        if (g -> x[v] == 0 && g -> y[v] == 0) continue;
+        c.chaves[c.tamanho++] = chavePosicao(g -> x[v], g -> y[v]);
+    }
+
+    normalizarConjunto(&c);
+
+    return c;
+
+}
+
+/**
+ * @brief Compara dois conjuntos e liberta-os.
+ *
+ * @param a Primeiro conjunto.
+ * @param b Segundo conjunto.
+ * @return true se forem iguais.
+ */
+
+static bool mesmosConjuntos(ConjuntoPosicoes a, ConjuntoPosicoes b) {
+
+    bool iguais = a.chaves && b.chaves && a.tamanho == b.tamanho &&
+                  memcmp(a.chaves, b.chaves, a.tamanho * sizeof(long long)) == 0;
+
+    free(a.chaves);
+    free(b.chaves);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Sorteia um valor em [0, limite) com um gerador congruencial.
+ *
+ * @param estado Estado do gerador (atualizado).
+ * @param limite Limite exclusivo (maior que 0).
+ * @return Valor sorteado.
+ */
+
+static unsigned int sortear(unsigned int *estado, unsigned int limite) {
+
+    *estado = *estado * 1103515245u + 12345u;
+
+    return (*estado >> 8) % limite;
+
+}
+
+/**
+ * @brief Deriva da semente os parâmetros do mapa e do grafo de um caso.
+ *
+ * @param semente Semente do caso.
+ * @return Parâmetros do caso.
+ */
+
+static CasoVerificacao sortearCaso(unsigned int semente) {
+
+    CasoVerificacao c;
+    c.semente = semente;
+    c.sorteio = semente * 2654435761u;
+
+    unsigned int sorteio = c.sorteio;
+    c.mapa = (ParametrosMapa){ 4 + (int)(sorteio % 45), 4 + (int)((sorteio >> 8) % 45),
+                               0.02 + ((sorteio >> 16) % 20) / 100.0, 1 + (int)((sorteio >> 24) % 6), 0.5, semente };
+    c.numVertices = 2 + (int)(sorteio % 39);
+    c.numFrequencias = 1 + (int)((sorteio >> 12) % 3);
+    c.grau = (int)((sorteio >> 20) % 5);
+
+    return c;
+
+}
+
+/**
+ * @brief Gera o grafo de um caso (cada chamada devolve uma cópia nova e igual).
+ *
+ * @param caso Parâmetros do caso.
+ * @return Grafo gerado, ou NULL em caso de falha de memória.
+ */
+
+static Vertice *gerarGrafoCaso(const CasoVerificacao *caso) {
+
+    return gerarGrafoDenso(caso -> numVertices, caso -> numFrequencias, caso -> grau, caso -> semente);
+
+}
+
+/**
+ * @brief Gera o grafo de um caso já em formato compacto.
+ *
+ * @param caso Parâmetros do caso.
+ * @return Grafo compacto, ou NULL em caso de falha de memória.
+ */
+
+static GrafoCSR *gerarCSRCaso(const CasoVerificacao *caso) {
+
+    Vertice *grafo = gerarGrafoCaso(caso);
+    GrafoCSR *g = grafo ? construirGrafoCSR(grafo) : NULL;
+    libertarGrafo(grafo);
+
+    return g;
+
+}
+
+/**
+ * @brief Sorteia um retângulo cujos cantos podem sair do mapa.
+ *
+ * @param sorteio Estado do gerador (atualizado).
+ * @param linhas Número de linhas do mapa.
+ * @param colunas Número de colunas do mapa.
+ * @param margem Células que os cantos podem exceder de cada lado.
+ * @return Retângulo sorteado, com os cantos por qualquer ordem.
+ */
+
+static Retangulo sortearRetangulo(unsigned int *sorteio, int linhas, int colunas, int margem) {
+
+    Retangulo r;
+    r.x1 = (int)sortear(sorteio, (unsigned)(linhas + 2 * margem)) - margem;
+    r.x2 = (int)sortear(sorteio, (unsigned)(linhas + 2 * margem)) - margem;
+    r.y1 = (int)sortear(sorteio, (unsigned)(colunas + 2 * margem)) - margem;
+    r.y2 = (int)sortear(sorteio, (unsigned)(colunas + 2 * margem)) - margem;
+
+    return r;
+
+}
+
+/**
+ * @brief Sorteia uma das frequências usadas pelo gerador de mapas.
+ *
+ * @param sorteio Estado do gerador (atualizado).
+ * @param numFrequencias Frequências do mapa.
+ * @return Frequência sorteada.
+ */
+
+static Frequencia sortearFrequencia(unsigned int *sorteio, int numFrequencias) {
+
+    return frequenciaCaracter((char)('A' + sortear(sorteio, (unsigned)numFrequencias)));
+
+}
+
+/**
+ * @brief Insere ou remove uma antena sorteada na lista.
+ *
+ * A estrutura verificada tem de receber a mesma alteração: uma remoção só
+ * acontece se havia uma antena na posição, uma inserção só se a célula estava livre.
+ *
+ * @param lista Lista de antenas (atualizada).
+ * @param sorteio Estado do gerador (atualizado).
+ * @param mapa Parâmetros do mapa.
+ * @param margem Células que a posição pode exceder o mapa de cada lado.
+ * @return Alteração sorteada.
+ */
+
+static AlteracaoAntena alterarAntenas(Antena **lista, unsigned int *sorteio, const ParametrosMapa *mapa, int margem) {
+
+    AlteracaoAntena alteracao;
+    alteracao.x = (int)sortear(sorteio, (unsigned)(mapa -> linhas + 2 * margem)) - margem;
+    alteracao.y = (int)sortear(sorteio, (unsigned)(mapa -> colunas + 2 * margem)) - margem;
+    alteracao.insercao = sortear(sorteio, 2) == 0;
+    alteracao.efetiva = false;
+    alteracao.frequencia = 0;
+
+    if (alteracao.insercao) {
+        alteracao.frequencia = sortearFrequencia(sorteio, mapa -> numFrequencias);
+        Antena *nova = inserirAntena(*lista, alteracao.frequencia, alteracao.x, alteracao.y);
+        if (nova) {
+            *lista = nova;
+            alteracao.efetiva = true;
+        }
+    } else {
+        *lista = removerAntena(*lista, alteracao.x, alteracao.y, &alteracao.efetiva);
+    }
+
+    return alteracao;
+
+}
+
+/**
+ * @brief Compara a grelha de densidade com contagens por força bruta.
+ *
+ * A referência conta os pontos médios de todos os pares da lista numa matriz e
+ * percorre-a em cada retângulo. Os retângulos sorteados podem estar invertidos
+ * ou sair do mapa (nesse caso o máximo tem de ser -1 e o total 0).
+ *
+ * @param caso Parâmetros do caso (o mapa gerado é o dos locais nefastos).
+ * @param tempoReferencia Recebe o tempo da força bruta.
+ * @param tempoOtimizado Recebe o tempo da grelha.
+ * @return true se todos os totais e máximos coincidirem.
+ */
+
+static bool verificarDensidade(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    int linhas = caso -> mapa.linhas, colunas = caso -> mapa.colunas;
+    unsigned int sorteio = caso -> sorteio;
+    Antena *lista = gerarAntenas(caso -> mapa);
+
+    double inicio = tempoAtual();
+    int *contagem = (int *)calloc((size_t)linhas * colunas, sizeof(int));
+    if (!contagem) {
+        libertarAntenas(lista);
+        return false;
+    }
+    for (Antena *a = lista; a; a = a -> proximo) {
+        for (Antena *b = a -> proximo; b; b = b -> proximo) {
+            if (a -> frequencia != b -> frequencia) continue;
+            int dx = b -> x - a -> x, dy = b -> y - a -> y;
+            if (dx % 2 != 0 || dy % 2 != 0) continue;
+            int mx = a -> x + dx / 2, my = a -> y + dy / 2;
+            if (mx >= 0 && mx < linhas && my >= 0 && my < colunas) contagem[(size_t)mx * colunas + my]++;
+        }
+    }
+    *tempoReferencia = tempoAtual() - inicio;
+
+    inicio = tempoAtual();
+    GrelhaInterferencia *g = construirGrelhaInterferencia(lista, linhas, colunas);
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    bool iguais = g != NULL;
+    for (int i = 0; i < 8 && iguais; i++) {
+
+        Retangulo r = sortearRetangulo(&sorteio, linhas, colunas, 3);
+
+        inicio = tempoAtual();
+        int xa = r.x1 < r.x2 ? r.x1 : r.x2, xb = r.x1 < r.x2 ? r.x2 : r.x1;
+        int ya = r.y1 < r.y2 ? r.y1 : r.y2, yb = r.y1 < r.y2 ? r.y2 : r.y1;
+        if (xa < 0) xa = 0;
+        if (ya < 0) ya = 0;
+        if (xb >= linhas) xb = linhas - 1;
+        if (yb >= colunas) yb = colunas - 1;
+        long long total = 0;
+        int maximo = -1;
+        for (int x = xa; x <= xb; x++) {
+            for (int y = ya; y <= yb; y++) {
+                int c = contagem[(size_t)x * colunas + y];
+                total += c;
+                if (c > maximo) maximo = c;
+            }
+        }
+        *tempoReferencia += tempoAtual() - inicio;
+
+        int mx = -1, my = -1;
+        inicio = tempoAtual();
+        long long totalGrelha = totalRetangulo(g, r.x1, r.y1, r.x2, r.y2);
+        int maximoGrelha = maximoRetangulo(g, r.x1, r.y1, r.x2, r.y2, &mx, &my);
+        *tempoOtimizado += tempoAtual() - inicio;
+
+        iguais = totalGrelha == total && maximoGrelha == maximo &&
+                 (maximo < 0 || (mx >= xa && mx <= xb && my >= ya && my <= yb &&
+                                 contagemCelula(g, mx, my) == maximo &&
+                                 contagem[(size_t)mx * colunas + my] == maximo));
+
+    }
+
+    libertarGrelhaInterferencia(g);
+    free(contagem);
+    libertarAntenas(lista);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Codifica um arco (origem, destino) pelas coordenadas dos dois vértices.
+ *
+ * @param a Origem (coordenadas entre 0 e 65535).
+ * @param b Destino (coordenadas entre 0 e 65535).
+ * @return Chave do arco.
+ */
+
+static long long chaveArco(const Vertice *a, const Vertice *b) {
+
+    return chavePosicao((a -> x << 16) | a -> y, (b -> x << 16) | b -> y);
+
+}
+
+/**
+ * @brief Constrói o multiconjunto ordenado dos arcos de um grafo.
+ *
+ * Os repetidos são mantidos (o gerador pode criar ligações paralelas), para que
+ * um arco duplicado por um construtor altere o tamanho.
+ *
+ * @param grafo Lista de vértices.
+ * @param extra Espaço a reservar para arcos acrescentados pela referência.
+ * @return Arcos ordenados (vazio em caso de falha de memória).
+ */
+
+static ConjuntoPosicoes arcosGrafo(Vertice *grafo, long extra) {
+
+    ConjuntoPosicoes c = { 0, NULL };
+
+    long n = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        for (Aresta *a = v -> arestas; a; a = a -> proximo) n++;
+    }
+
+    c.chaves = (long long *)malloc((n + extra > 0 ? n + extra : 1) * sizeof(long long));
+    if (!c.chaves) {
+        return c;
+    }
+
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        for (Aresta *a = v -> arestas; a; a = a -> proximo) c.chaves[c.tamanho++] = chaveArco(v, a -> destino);
+    }
+
+    qsort(c.chaves, c.tamanho, sizeof(long long), compararChaves);
+
+    return c;
+
+}
+
+/**
+ * @brief Verifica se nenhum outro vértice ocupa uma célula entre a e b.
+ *
+ * @param grafo Lista de vértices.
+ * @param a Primeiro extremo.
+ * @param b Segundo extremo.
+ * @return true se o segmento estiver livre.
+ */
+
+static bool segmentoLivre(Vertice *grafo, const Vertice *a, const Vertice *b) {
+
+    for (Vertice *c = grafo; c; c = c -> proximo) {
+        if (c == a || c == b) continue;
+        long long produto = (long long)(b -> x - a -> x) * (c -> y - a -> y) - (long long)(b -> y - a -> y) * (c -> x - a -> x);
+        bool entreX = (c -> x - a -> x) * (c -> x - b -> x) <= 0;
+        bool entreY = (c -> y - a -> y) * (c -> y - b -> y) <= 0;
+        if (produto == 0 && entreX && entreY) return false;
+    }
+
+    return true;
+
+}
+
+/**
+ * @brief Compara um construtor de ligações geométricas com a construção ingénua.
+ *
+ * A referência testa todos os pares da mesma frequência: em linha de vista, o
+ * segmento não pode conter outro vértice; com alcance, a distância ao quadrado
+ * não pode exceder o do raio. O resultado esperado são os arcos
+ * originais mais os dois sentidos de cada par novo, e o número devolvido tem
+ * de ser o número de pares novos.
+ *
+ * @param caso Parâmetros do caso.
+ * @param raio Alcance para `ligarRaio`, ou negativo para `ligarVisiveis`.
+ * @param tempoReferencia Recebe o tempo da construção ingénua.
+ * @param tempoOtimizado Recebe o tempo do construtor.
+ * @return true se os arcos e a contagem coincidirem.
+ */
+
+static bool compararLigacoes(const CasoVerificacao *caso, double raio, double *tempoReferencia, double *tempoOtimizado) {
+
+    Vertice *grafo = gerarGrafoCaso(caso);
+    if (!grafo) {
+        return false;
+    }
+
+    double inicio = tempoAtual();
+    ConjuntoPosicoes esperado = arcosGrafo(grafo, (long)caso -> numVertices * (caso -> numVertices - 1));
+    long originais = esperado.tamanho, pares = 0;
+    for (Vertice *a = grafo; a && esperado.chaves; a = a -> proximo) {
+        for (Vertice *b = a -> proximo; b; b = b -> proximo) {
+            if (a -> frequencia != b -> frequencia) continue;
+            double dx = (double)b -> x - a -> x, dy = (double)b -> y - a -> y;
+            if (raio < 0 ? !segmentoLivre(grafo, a, b) : dx * dx + dy * dy > raio * raio) continue;
+            long long chave = chaveArco(a, b);
+            if (bsearch(&chave, esperado.chaves, originais, sizeof(long long), compararChaves)) continue;
+            esperado.chaves[esperado.tamanho++] = chave;
+            esperado.chaves[esperado.tamanho++] = chaveArco(b, a);
+            pares++;
+        }
+    }
+    qsort(esperado.chaves, esperado.tamanho, sizeof(long long), compararChaves);
+    *tempoReferencia = tempoAtual() - inicio;
+
+    inicio = tempoAtual();
+    long criadas = raio < 0 ? ligarVisiveis(grafo) : ligarRaio(grafo, raio);
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    bool iguais = criadas == pares;
+    iguais = mesmosConjuntos(esperado, arcosGrafo(grafo, 0)) && iguais;
+    libertarGrafo(grafo);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Compara `ligarVisiveis` com a construção ingénua.
+ *
+ * @param caso Parâmetros do caso.
+ * @param tempoReferencia Recebe o tempo da construção ingénua.
+ * @param tempoOtimizado Recebe o tempo do construtor.
+ * @return true se os arcos e a contagem coincidirem.
+ */
+
+static bool verificarVisiveis(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    return compararLigacoes(caso, -1, tempoReferencia, tempoOtimizado);
+
+}
+
+/**
+ * @brief Compara `ligarRaio` com a construção ingénua.
+ *
+ * Os raios sorteados são inteiros e fracionários, para exercitar o lado
+ * ceil(raio) das células.
+ *
+ * @param caso Parâmetros do caso.
+ * @param tempoReferencia Recebe o tempo da construção ingénua.
+ * @param tempoOtimizado Recebe o tempo do construtor.
+ * @return true se os arcos e a contagem coincidirem.
+ */
+
+static bool verificarRaio(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    double raio = ((caso -> sorteio >> 6) % 13) / 2.0;
+
+    return compararLigacoes(caso, raio, tempoReferencia, tempoOtimizado);
+
+}
+
+/**
+ * @brief Compara as procuras da árvore k-d com percursos lineares da lista.
+ *
+ * A lista e a árvore recebem as mesmas inserções e remoções (mais do que
+ * `MIN_ALTERACOES_KD`, para forçar reconstruções). A referência ordena as antenas
+ * por (distância, x, y), a ordem de desempate da árvore, pelo que as k mais
+ * próximas têm de coincidir pela ordem.
+ *
+ * @param caso Parâmetros do caso (o mapa gerado é o dos locais nefastos).
+ * @param tempoReferencia Recebe o tempo dos percursos lineares.
+ * @param tempoOtimizado Recebe o tempo da árvore.
+ * @return true se todas as consultas coincidirem.
+ */
+
+static bool verificarArvoreKD(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    *tempoReferencia = 0;
+    unsigned int sorteio = caso -> sorteio;
+    Antena *lista = gerarAntenas(caso -> mapa);
+
+    double inicio = tempoAtual();
+    ArvoreKD *a = construirArvoreKD(lista);
+    bool iguais = a != NULL;
+
+    for (int i = 0; i < 2 * MIN_ALTERACOES_KD && iguais; i++) {
+        AlteracaoAntena alteracao = alterarAntenas(&lista, &sorteio, &caso -> mapa, 0);
+        if (!alteracao.insercao) {
+            iguais = removerPontoKD(a, alteracao.x, alteracao.y) == alteracao.efetiva;
+        } else if (alteracao.efetiva) {
+            iguais = inserirPontoKD(a, alteracao.frequencia, alteracao.x, alteracao.y);
+        }
+    }
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    long n = 0;
+    for (Antena *p = lista; p; p = p -> proximo) n++;
+    long long *ordem = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    PontoKD vizinhas[8];
+    iguais = iguais && ordem;
+
+    for (int c = 0; c < 8 && iguais; c++) {
+
+        // Consultas também fora do mapa; a frequência pode ser qualquer
+        int x = (int)sortear(&sorteio, (unsigned)caso -> mapa.linhas + 6) - 3;
+        int y = (int)sortear(&sorteio, (unsigned)caso -> mapa.colunas + 6) - 3;
+        Frequencia f = sortear(&sorteio, 3) == 0 ? FREQUENCIA_QUALQUER : sortearFrequencia(&sorteio, caso -> mapa.numFrequencias);
+        int k = 1 + (int)sortear(&sorteio, 8);
+        int raio = (int)sortear(&sorteio, 9);
+
+        // Chave (distância, x, y): as antenas da lista estão dentro do mapa
+        inicio = tempoAtual();
+        long m = 0;
+        ConjuntoPosicoes circulo = { 0, (long long *)malloc((n > 0 ? n : 1) * sizeof(long long)) };
+        for (Antena *p = lista; p && circulo.chaves; p = p -> proximo) {
+            if (f != FREQUENCIA_QUALQUER && p -> frequencia != f) continue;
+            long long dx = p -> x - x, dy = p -> y - y;
+            ordem[m++] = ((dx * dx + dy * dy) << 40) | ((long long)p -> x << 20) | p -> y;
+            if (dx * dx + dy * dy <= (long long)raio * raio) circulo.chaves[circulo.tamanho++] = chavePosicao(p -> x, p -> y);
+        }
+        qsort(ordem, m, sizeof(long long), compararChaves);
+        normalizarConjunto(&circulo);
+        *tempoReferencia += tempoAtual() - inicio;
+
+        PontoKD maisProxima;
+        inicio = tempoAtual();
+        bool encontrada = maisProximaKD(a, x, y, f, &maisProxima);
+        int numVizinhas = vizinhasKD(a, x, y, f, k, vizinhas);
+        Coordenada *dentro = raioKD(a, x, y, raio, f);
+        *tempoOtimizado += tempoAtual() - inicio;
+
+        iguais = encontrada == (m > 0) && numVizinhas == (m < k ? m : k) &&
+                 (!encontrada || (maisProxima.x == (int)(ordem[0] >> 20 & 0xFFFFF) &&
+                                  maisProxima.y == (int)(ordem[0] & 0xFFFFF)));
+        for (int v = 0; v < numVizinhas && iguais; v++) {
+            iguais = vizinhas[v].x == (int)(ordem[v] >> 20 & 0xFFFFF) && vizinhas[v].y == (int)(ordem[v] & 0xFFFFF);
+        }
+        iguais = mesmosConjuntos(circulo, conjuntoLista(dentro, false)) && iguais;
+        libertarCoordenadas(dentro);
+
+    }
+
+    free(ordem);
+    libertarArvoreKD(a);
+    libertarAntenas(lista);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Compara as consultas do índice de regiões com um percurso filtrado da lista.
+ *
+ * A lista e o índice recebem as mesmas inserções e remoções, também de posições
+ * fora do mapa (guardadas nos baldes da margem).
+ *
+ * @param caso Parâmetros do caso (o mapa gerado é o dos locais nefastos).
+ * @param tempoReferencia Recebe o tempo dos percursos da lista.
+ * @param tempoOtimizado Recebe o tempo do índice.
+ * @return true se todas as consultas coincidirem.
+ */
+
+static bool verificarRegioes(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    *tempoReferencia = 0;
+    unsigned int sorteio = caso -> sorteio;
+    Antena *lista = gerarAntenas(caso -> mapa);
+
+    double inicio = tempoAtual();
+    IndiceRegioes *ind = construirIndiceRegioes(lista, caso -> mapa.linhas, caso -> mapa.colunas);
+    bool iguais = ind != NULL;
+
+    for (int i = 0; i < 48 && iguais; i++) {
+        AlteracaoAntena alteracao = alterarAntenas(&lista, &sorteio, &caso -> mapa, 3);
+        if (!alteracao.insercao) {
+            iguais = removerAntenaRegiao(ind, alteracao.x, alteracao.y) == alteracao.efetiva;
+        } else if (alteracao.efetiva) {
+            iguais = inserirAntenaRegiao(ind, alteracao.frequencia, alteracao.x, alteracao.y);
+        }
+    }
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    long n = 0;
+    for (Antena *p = lista; p; p = p -> proximo) n++;
+    iguais = iguais && ind -> numAntenas == n;
+
+    for (int c = 0; c < 8 && iguais; c++) {
+
+        Retangulo r = sortearRetangulo(&sorteio, caso -> mapa.linhas, caso -> mapa.colunas, 4);
+        Frequencia f = sortear(&sorteio, 3) == 0 ? FREQUENCIA_QUALQUER : sortearFrequencia(&sorteio, caso -> mapa.numFrequencias);
+
+        inicio = tempoAtual();
+        int xa = r.x1 < r.x2 ? r.x1 : r.x2, xb = r.x1 < r.x2 ? r.x2 : r.x1;
+        int ya = r.y1 < r.y2 ? r.y1 : r.y2, yb = r.y1 < r.y2 ? r.y2 : r.y1;
+        ConjuntoPosicoes esperado = { 0, (long long *)malloc((n > 0 ? n : 1) * sizeof(long long)) };
+        for (Antena *p = lista; p && esperado.chaves; p = p -> proximo) {
+            if (p -> x < xa || p -> x > xb || p -> y < ya || p -> y > yb) continue;
+            if (f != FREQUENCIA_QUALQUER && p -> frequencia != f) continue;
+            esperado.chaves[esperado.tamanho++] = chavePosicao(p -> x, p -> y);
+        }
+        long total = esperado.tamanho;
+        normalizarConjunto(&esperado);
+        *tempoReferencia += tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        Coordenada *encontradas = antenasRetangulo(ind, r.x1, r.y1, r.x2, r.y2, f);
+        long contadas = contarRetangulo(ind, r.x1, r.y1, r.x2, r.y2, f);
+        *tempoOtimizado += tempoAtual() - inicio;
+
+        long numEncontradas = 0;
+        for (Coordenada *p = encontradas; p; p = p -> proximo) numEncontradas++;
+
+        iguais = contadas == total && numEncontradas == total;
+        iguais = mesmosConjuntos(esperado, conjuntoLista(encontradas, false)) && iguais;
+        libertarCoordenadas(encontradas);
+
+    }
+
+    libertarIndiceRegioes(ind);
+    libertarAntenas(lista);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Remove vértices sorteados e verifica a integridade do grafo resultante.
+ *
+ * A referência filtra os arcos originais que tocam um vértice removido. Depois
+ * das remoções, a lista de vértices tem de estar bem encadeada nos dois
+ * sentidos, cada aresta tem de ter a sua inversa e nenhum destino pode ser um
+ * vértice removido (comparado por endereço, sem o desreferenciar).
+ *
+ * @param caso Parâmetros do caso.
+ * @param tempoReferencia Recebe o tempo da filtragem dos arcos.
+ * @param tempoOtimizado Recebe o tempo das remoções.
+ * @return true se a estrutura e os arcos restantes estiverem corretos.
+ */
+
+static bool verificarRemocao(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    int numVertices = caso -> numVertices;
+    Vertice *grafo = gerarGrafoCaso(caso);
+    Vertice **removidos = (Vertice **)malloc(numVertices * sizeof(Vertice *));
+    Vertice **vivos = (Vertice **)malloc(numVertices * sizeof(Vertice *));
+    ConjuntoPosicoes posicoes = { 0, (long long *)malloc(numVertices * sizeof(long long)) };
+    if (!grafo || !removidos || !vivos || !posicoes.chaves) {
+        libertarGrafo(grafo);
+        free(removidos);
+        free(vivos);
+        free(posicoes.chaves);
+        return false;
+    }
+
+    // Cerca de um terço dos vértices, incluindo por vezes o primeiro e o último
+    unsigned int sorteio = caso -> sorteio;
+    int numRemovidos = 0, numVivos = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        if (sortear(&sorteio, 3) == 0) {
+            removidos[numRemovidos++] = v;
+            posicoes.chaves[posicoes.tamanho++] = chavePosicao(v -> x, v -> y);
+        } else {
+            vivos[numVivos++] = v;
+        }
+    }
+    normalizarConjunto(&posicoes);
+
+    double inicio = tempoAtual();
+    ConjuntoPosicoes esperado = arcosGrafo(grafo, 0);
+    long k = 0;
+    for (long i = 0; i < esperado.tamanho; i++) {
+        long long origem = chavePosicao(esperado.chaves[i] >> 48, (esperado.chaves[i] >> 32) & 0xFFFF);
+        long long destino = chavePosicao((esperado.chaves[i] >> 16) & 0xFFFF, esperado.chaves[i] & 0xFFFF);
+        if (bsearch(&origem, posicoes.chaves, posicoes.tamanho, sizeof(long long), compararChaves) ||
+            bsearch(&destino, posicoes.chaves, posicoes.tamanho, sizeof(long long), compararChaves)) continue;
+        esperado.chaves[k++] = esperado.chaves[i];
+    }
+    esperado.tamanho = k;
+    *tempoReferencia = tempoAtual() - inicio;
+
+    inicio = tempoAtual();
+    for (int i = 0; i < numRemovidos; i++) grafo = removerVertice(grafo, removidos[i]);
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    int contados = 0;
+    bool integro = !grafo || !grafo -> anterior;
+    for (Vertice *v = grafo; v && integro; v = v -> proximo) {
+        contados++;
+        integro = !v -> proximo || v -> proximo -> anterior == v;
+        for (Aresta *a = v -> arestas; a && integro; a = a -> proximo) {
+            integro = a -> inversa && a -> inversa -> inversa == a && a -> inversa -> destino == v &&
+                      (a -> anterior ? a -> anterior -> proximo == a : v -> arestas == a);
+            bool destinoVivo = false;
+            for (int j = 0; j < numVivos && !destinoVivo; j++) destinoVivo = vivos[j] == a -> destino;
+            integro = integro && destinoVivo;
+        }
+    }
+    integro = integro && contados == numVivos;
+
+    // Os arcos só são percorridos com a estrutura íntegra
+    bool iguais = false;
+    if (integro) {
+        iguais = mesmosConjuntos(esperado, arcosGrafo(grafo, 0));
+    } else {
+        free(esperado.chaves);
+    }
+
+    libertarGrafo(grafo);
+    free(removidos);
+    free(vivos);
+    free(posicoes.chaves);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Procura um vértice pelas coordenadas, percorrendo a lista.
+ *
+ * @param grafo Lista de vértices.
+ * @param x Coordenada X.
+ * @param y Coordenada Y.
+ * @return Vértice encontrado, ou NULL.
+ */
+
+static Vertice *verticeLinear(Vertice *grafo, int x, int y) {
+
+    for (Vertice *v = grafo; v; v = v -> proximo) {
+        if (v -> x == x && v -> y == y) return v;
+    }
+
+    return NULL;
+
+}
+
+/**
+ * @brief Compara a inserção em lote com inserções uma a uma num grafo gémeo.
+ *
+ * Os dois grafos são gerados com a mesma semente. A referência resolve cada par
+ * percorrendo a lista e a adjacência da origem, pela ordem do lote, pelo que os
+ * repetidos (no lote ou já no grafo) são vistos como ligações existentes.
+ *
+ * @param caso Parâmetros do caso.
+ * @param tempoReferencia Recebe o tempo das inserções uma a uma.
+ * @param tempoOtimizado Recebe o tempo do lote.
+ * @return true se os arcos e o resumo coincidirem.
+ */
+
+static bool verificarLigacoesLote(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    *tempoReferencia = *tempoOtimizado = 0;
+
+    Vertice *grafo = gerarGrafoCaso(caso);
+    Vertice *gemeo = gerarGrafoCaso(caso);
+    long numPares = 2L * caso -> numVertices;
+    ParLigacao *pares = (ParLigacao *)malloc(numPares * sizeof(ParLigacao));
+    Vertice **vertices = (Vertice **)malloc(caso -> numVertices * sizeof(Vertice *));
+    if (!grafo || !gemeo || !pares || !vertices) {
+        libertarGrafo(grafo);
+        libertarGrafo(gemeo);
+        free(pares);
+        free(vertices);
+        return false;
+    }
+
+    int n = 0;
+    for (Vertice *v = grafo; v; v = v -> proximo) vertices[n++] = v;
+
+    // Pares entre vértices, com células vazias, a mesma célula e repetidos invertidos
+    unsigned int sorteio = caso -> sorteio;
+    for (long i = 0; i < numPares; i++) {
+        Vertice *a = vertices[sortear(&sorteio, (unsigned)n)], *b = vertices[sortear(&sorteio, (unsigned)n)];
+        unsigned int tipo = sortear(&sorteio, 8);
+        if (tipo == 0 && i > 0) {
+            pares[i] = (ParLigacao){ pares[i - 1].x2, pares[i - 1].y2, pares[i - 1].x1, pares[i - 1].y1 };
+        } else if (tipo == 1) {
+            pares[i] = (ParLigacao){ a -> x, a -> y, -1 - (int)sortear(&sorteio, 4), b -> y };
+        } else if (tipo == 2) {
+            pares[i] = (ParLigacao){ a -> x, a -> y, a -> x, a -> y };
+        } else {
+            pares[i] = (ParLigacao){ a -> x, a -> y, b -> x, b -> y };
+        }
+    }
+
+    double inicio = tempoAtual();
+    ResumoLigacoes esperado = { 0, 0, 0, 0 };
+    bool iguais = true;
+    for (long i = 0; i < numPares && iguais; i++) {
+        Vertice *v1 = verticeLinear(gemeo, pares[i].x1, pares[i].y1);
+        Vertice *v2 = verticeLinear(gemeo, pares[i].x2, pares[i].y2);
+        if (!v1 || !v2 || v1 == v2) {
+            esperado.semVertice++;
+            continue;
+        }
+        if (v1 -> frequencia != v2 -> frequencia) {
+            esperado.frequenciaDiferente++;
+            continue;
+        }
+        bool existe = false;
+        for (Aresta *a = v1 -> arestas; a && !existe; a = a -> proximo) existe = a -> destino == v2;
+        if (existe) {
+            esperado.duplicadas++;
+        } else {
+            iguais = ligarVertices(v1, v2);
+            esperado.criadas++;
+        }
+    }
+    *tempoReferencia = tempoAtual() - inicio;
+
+    // Metade dos casos usa um índice já construído
+    IndiceCoordenadas *ind = sortear(&sorteio, 2) == 0 ? construirIndiceCoordenadas(grafo) : NULL;
+    ResumoLigacoes resumo;
+    inicio = tempoAtual();
+    iguais = ligarEmLote(grafo, ind, pares, numPares, &resumo) && iguais;
+    *tempoOtimizado = tempoAtual() - inicio;
+    libertarIndiceCoordenadas(ind);
+
+    iguais = iguais && resumo.criadas == esperado.criadas && resumo.semVertice == esperado.semVertice &&
+             resumo.frequenciaDiferente == esperado.frequenciaDiferente && resumo.duplicadas == esperado.duplicadas;
+    iguais = mesmosConjuntos(arcosGrafo(gemeo, 0), arcosGrafo(grafo, 0)) && iguais;
+
+    libertarGrafo(grafo);
+    libertarGrafo(gemeo);
+    free(pares);
+    free(vertices);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Compara o fecho transitivo com procuras em largura de cada origem.
+ *
+ * O grafo é dirigido e construído diretamente em CSR (os grafos de antenas
+ * são simétricos e não exercitam componentes fortes distintas). O orçamento
+ * sorteado é por vezes mínimo, para que haja componentes recusadas: só nelas
+ * se aceita ALCANCE_DESCONHECIDO.
+ *
+ * @param caso Parâmetros do caso (só o sorteio é usado).
+ * @param tempoReferencia Recebe o tempo das procuras.
+ * @param tempoOtimizado Recebe o tempo da construção e das consultas do fecho.
+ * @return true se todos os pares coincidirem.
+ */
+
+static bool verificarFecho(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    *tempoReferencia = *tempoOtimizado = 0;
+    unsigned int sorteio = caso -> sorteio;
+
+    int n = 1 + (int)sortear(&sorteio, 80);
+    int m = (int)sortear(&sorteio, (unsigned)(2 * n + 1));
+
+    GrafoCSR *g = (GrafoCSR *)calloc(1, sizeof(GrafoCSR));
+    int *origens = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    int *fila = (int *)malloc(n * sizeof(int));
+    char *visto = (char *)malloc(n);
+    if (!g || !origens || !fila || !visto) {
+        free(origens);
+        free(fila);
+        free(visto);
+        libertarGrafoCSR(g);
+        return false;
+    }
+
+    g -> numVertices = n;
+    g -> numArcos = m;
+    g -> frequencia = calloc(n, sizeof(*g -> frequencia));
+    g -> x = (int *)calloc(n, sizeof(int));
+    g -> y = (int *)calloc(n, sizeof(int));
+    g -> inicioArestas = (int *)calloc(n + 1, sizeof(int));
+    g -> destinos = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    bool iguais = g -> frequencia && g -> x && g -> y && g -> inicioArestas && g -> destinos;
+
+    // Arcos sorteados (com lacetes e repetidos), agrupados por origem
+    for (int a = 0; a < m && iguais; a++) {
+        origens[a] = (int)sortear(&sorteio, (unsigned)n);
+        g -> inicioArestas[origens[a] + 1]++;
+    }
+    for (int v = 0; v < n && iguais; v++) g -> inicioArestas[v + 1] += g -> inicioArestas[v];
+    if (iguais) memcpy(fila, g -> inicioArestas, n * sizeof(int));
+    for (int a = 0; a < m && iguais; a++) {
+        g -> destinos[fila[origens[a]]++] = (int)sortear(&sorteio, (unsigned)n);
+    }
+
+    size_t orcamento = sortear(&sorteio, 2) == 0 ? ORCAMENTO_FECHO_PADRAO : (size_t)sortear(&sorteio, 256);
+
+    double inicio = tempoAtual();
+    FechoTransitivo *f = iguais ? construirFecho(g, orcamento) : NULL;
+    *tempoOtimizado += tempoAtual() - inicio;
+    iguais = f && (orcamento < ORCAMENTO_FECHO_PADRAO || f -> componentesRecusadas == 0);
+
+    for (int u = 0; u < n && iguais; u++) {
+
+        inicio = tempoAtual();
+        memset(visto, 0, n);
+        int cabeca = 0, cauda = 0;
+        fila[cauda++] = u;
+        visto[u] = 1;
+        while (cabeca < cauda) {
+            int v = fila[cabeca++];
+            for (int a = g -> inicioArestas[v]; a < g -> inicioArestas[v + 1]; a++) {
+                if (!visto[g -> destinos[a]]) {
+                    visto[g -> destinos[a]] = 1;
+                    fila[cauda++] = g -> destinos[a];
+                }
+            }
+        }
+        *tempoReferencia += tempoAtual() - inicio;
+
+        bool recusada = f -> inicioComponente[f -> componente[u]] < 0;
+        for (int v = 0; v < n && iguais; v++) {
+            inicio = tempoAtual();
+            int alcance = alcancaFecho(f, u, v);
+            *tempoOtimizado += tempoAtual() - inicio;
+            iguais = alcance == visto[v] || (recusada && alcance == ALCANCE_DESCONHECIDO);
+        }
+
+    }
+
+    libertarFecho(f);
+    libertarGrafoCSR(g);
+    free(origens);
+    free(fila);
+    free(visto);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Compara os indicadores da análise com procuras em largura de todos os vértices.
+ *
+ * As componentes têm de formar a mesma partição que as procuras e o grau e os
+ * histogramas têm de ser exatos. O diâmetro por dupla varredura é só um limite
+ * inferior: tem de ficar entre ceil(D / 2) e o diâmetro exato D da componente.
+ *
+ * @param caso Parâmetros do caso (a semente também é a da amostragem das centralidades).
+ * @param tempoReferencia Recebe o tempo das procuras.
+ * @param tempoOtimizado Recebe o tempo da análise.
+ * @return true se todos os indicadores verificados estiverem corretos.
+ */
+
+static bool verificarAnalise(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    GrafoCSR *g = gerarCSRCaso(caso);
+    if (!g) {
+        return false;
+    }
+    int n = g -> numVertices;
+
+    double inicio = tempoAtual();
+    AnaliseGrafo *a = analisarGrafo(g, AMOSTRAS_ANALISE_PADRAO, caso -> semente);
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    int *distancia = (int *)malloc(n * sizeof(int));
+    int *fila = (int *)malloc(n * sizeof(int));
+    int *excentricidade = (int *)calloc(n, sizeof(int));
+    bool iguais = a && distancia && fila && excentricidade && a -> numVertices == n;
+
+    // Componentes numeradas pelo primeiro vértice, para contar as da análise
+    inicio = tempoAtual();
+    int componentes = 0, grauMaximo = 0;
+    for (int u = 0; u < n && iguais; u++) {
+
+        for (int v = 0; v < n; v++) distancia[v] = -1;
+        int cabeca = 0, cauda = 0;
+        fila[cauda++] = u;
+        distancia[u] = 0;
+        while (cabeca < cauda) {
+            int v = fila[cabeca++];
+            for (int k = g -> inicioArestas[v]; k < g -> inicioArestas[v + 1]; k++) {
+                int w = g -> destinos[k];
+                if (distancia[w] < 0) {
+                    distancia[w] = distancia[v] + 1;
+                    fila[cauda++] = w;
+                }
+            }
+        }
+
+        bool primeiro = true;
+        for (int v = 0; v < n && iguais; v++) {
+            if (distancia[v] >= 0 && v < u) primeiro = false;
+            iguais = (distancia[v] >= 0) == (a -> componente[u] == a -> componente[v]);
+        }
+        componentes += primeiro;
+        excentricidade[u] = distancia[fila[cauda - 1]];
+        iguais = iguais && a -> tamanhoComponente[a -> componente[u]] == cauda;
+
+        int grau = g -> inicioArestas[u + 1] - g -> inicioArestas[u];
+        if (grau > grauMaximo) grauMaximo = grau;
+
+    }
+    *tempoReferencia = tempoAtual() - inicio;
+
+    iguais = iguais && a -> numComponentes == componentes && a -> grauMaximo == grauMaximo;
+
+    long *histograma = iguais ? (long *)calloc(grauMaximo + 1, sizeof(long)) : NULL;
+    iguais = histograma != NULL;
+    for (int u = 0; u < n && iguais; u++) histograma[g -> inicioArestas[u + 1] - g -> inicioArestas[u]]++;
+    for (int k = 0; k <= grauMaximo && iguais; k++) iguais = histograma[k] == a -> histogramaGrau[k];
+    free(histograma);
+
+    // Diâmetro exato de cada componente: maior excentricidade dos seus vértices
+    for (int u = 0; u < n && iguais; u++) {
+        int exato = 0;
+        for (int v = 0; v < n; v++) {
+            if (a -> componente[v] == a -> componente[u] && excentricidade[v] > exato) exato = excentricidade[v];
+        }
+        int estimado = a -> diametroComponente[a -> componente[u]];
+        iguais = estimado <= exato && 2 * estimado >= exato;
+    }
+
+    free(distancia);
+    free(fila);
+    free(excentricidade);
+    libertarAnaliseGrafo(a);
+    libertarGrafoCSR(g);
+
+    return iguais;
+
+}
+
+/**
+ * @brief Compara o dicionário de frequências com uma procura linear pelos nomes.
+ *
+ * Os nomes novos vêm de um conjunto limitado, para que execuções longas não
+ * esgotem os identificadores. Cada nome tem de sobreviver à ida e volta,
+ * codificar de novo tem de devolver o mesmo identificador e as procuras
+ * (incluindo de nomes nunca codificados) não podem acrescentar entradas.
+ *
+ * @param caso Parâmetros do caso (só o sorteio é usado).
+ * @param tempoReferencia Recebe o tempo das procuras lineares.
+ * @param tempoOtimizado Recebe o tempo das procuras no dicionário.
+ * @return true se todas as verificações passarem.
+ */
+
+static bool verificarFrequencias(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    *tempoReferencia = *tempoOtimizado = 0;
+    unsigned int sorteio = caso -> sorteio;
+    bool iguais = true;
+
+    for (int i = 0; i < 16 && iguais; i++) {
+
+        char nome[TAMANHO_NOME_FREQUENCIA];
+        snprintf(nome, sizeof(nome), "verif%u", sortear(&sorteio, 64));
+        Frequencia f = codificarFrequencia(nome);
+        int total = numFrequencias();
+
+        iguais = f != FREQUENCIA_QUALQUER && nomeFrequencia(f) && strcmp(nomeFrequencia(f), nome) == 0 &&
+                 codificarFrequencia(nome) == f;
+
+        // Nome nunca codificado: a procura falha sem o registar
+        char ausente[TAMANHO_NOME_FREQUENCIA];
+        snprintf(ausente, sizeof(ausente), "ausente%u", sortear(&sorteio, 1000));
+
+        double inicio = tempoAtual();
+        int linear = -1, linearAusente = -1;
+        for (int k = 0; k < total; k++) {
+            if (strcmp(nomeFrequencia((Frequencia)k), nome) == 0) linear = k;
+            if (strcmp(nomeFrequencia((Frequencia)k), ausente) == 0) linearAusente = k;
+        }
+        *tempoReferencia += tempoAtual() - inicio;
+
+        Frequencia procurada = FREQUENCIA_QUALQUER, procuradaAusente = FREQUENCIA_QUALQUER;
+        inicio = tempoAtual();
+        bool encontrada = procurarFrequencia(nome, &procurada);
+        bool encontradaAusente = procurarFrequencia(ausente, &procuradaAusente);
+        *tempoOtimizado += tempoAtual() - inicio;
+
+        iguais = iguais && encontrada && procurada == f && linear == f &&
+                 !encontradaAusente && linearAusente < 0 && numFrequencias() == total;
+
+        // Os nomes de um carácter do mapa partilham o dicionário com os restantes
+        char simbolo[2] = { (char)('A' + sortear(&sorteio, 26)), '\0' };
+        iguais = iguais && frequenciaCaracter(simbolo[0]) == codificarFrequencia(simbolo);
+
+    }
+
+    return iguais;
+
+}
+
+/**
+ * @brief Lê um ficheiro inteiro para memória.
+ *
+ * @param nome Nome do ficheiro.
+ * @param tamanho Recebe o número de bytes lidos.
+ * @return Conteúdo (a libertar com `free`), ou NULL se não for possível ler.
+ */
+
+static char *lerFicheiro(const char *nome, long *tamanho) {
+
+    FILE *f = fopen(nome, "rb");
+    if (!f) {
+        return NULL;
+    }
+
+    long capacidade = 4096;
+    char *conteudo = (char *)malloc(capacidade);
+    *tamanho = 0;
+
+    size_t lidos;
+    while (conteudo && (lidos = fread(conteudo + *tamanho, 1, capacidade - *tamanho, f)) > 0) {
+        *tamanho += (long)lidos;
+        if (*tamanho == capacidade) {
+            char *maior = (char *)realloc(conteudo, 2 * capacidade);
+            if (!maior) {
+                free(conteudo);
+            }
+            conteudo = maior;
+            capacidade *= 2;
+        }
+    }
+    fclose(f);
+
+    return conteudo;
+
+}
+
+/**
+ * @brief Compara um lote de consultas com as mesmas consultas executadas uma a uma.
+ *
+ * Cada consulta isolada é escrita na mesma linha do ficheiro que ocupa no lote
+ * (as linhas em branco são ignoradas mas contadas), pelo que a concatenação das
+ * respostas isoladas tem de coincidir byte a byte com a resposta do lote.
+ *
+ * @param caso Parâmetros do caso.
+ * @param tempoReferencia Recebe o tempo das consultas isoladas.
+ * @param tempoOtimizado Recebe o tempo do lote.
+ * @return true se as respostas coincidirem.
+ */
+
+static bool verificarLote(const CasoVerificacao *caso, double *tempoReferencia, double *tempoOtimizado) {
+
+    char consultas[CONSULTAS_LOTE][96];
+    *tempoReferencia = *tempoOtimizado = 0;
+
+    GrafoCSR *g = gerarCSRCaso(caso);
+    if (!g) {
+        return false;
+    }
+    int n = g -> numVertices;
+    unsigned int sorteio = caso -> sorteio;
+
+    for (int i = 0; i < CONSULTAS_LOTE; i++) {
+
+        int a = (int)sortear(&sorteio, (unsigned)n), b = (int)sortear(&sorteio, (unsigned)n);
+        unsigned int tipo = sortear(&sorteio, 4);
+
+        if (tipo == 0) {
+            snprintf(consultas[i], sizeof(consultas[i]), "alcance %d %d %d %d", g -> x[a], g -> y[a], g -> x[b], g -> y[b]);
+        } else if (tipo == 1) {
+            snprintf(consultas[i], sizeof(consultas[i]), "caminho %d %d %d %d", g -> x[a], g -> y[a], g -> x[b], g -> y[b]);
+        } else if (tipo == 2) {
+            // Inclui A == B e, às vezes, uma frequência que nenhuma antena usa
+            const char *nomeB = sortear(&sorteio, 4) == 0 ? "verificacao-sem-antenas" : nomeFrequencia(g -> frequencia[b]);
+            snprintf(consultas[i], sizeof(consultas[i]), "intersecoes %s %s", nomeFrequencia(g -> frequencia[a]), nomeB);
+        } else {
+            // Antena inexistente: fora da grelha do gerador
+            snprintf(consultas[i], sizeof(consultas[i]), "caminho %d %d -1 -1", g -> x[a], g -> y[a]);
+        }
+
+    }
+
+    // Lote: uma consulta por linha, com linhas em branco e comentários pelo meio
+    FILE *f = fopen(FICHEIRO_CONSULTAS_VERIFICACAO, "w");
+    if (!f) {
+        libertarGrafoCSR(g);
+        return false;
+    }
+
+    int linha[CONSULTAS_LOTE], numeroLinha = 0;
+    for (int i = 0; i < CONSULTAS_LOTE; i++) {
+        if (i % 5 == 4) {
+            fprintf(f, "\n# comentario\n");
+            numeroLinha += 2;
+        }
+        fprintf(f, "%s\n", consultas[i]);
+        linha[i] = ++numeroLinha;
+    }
+    fclose(f);
+
+    double inicio = tempoAtual();
+    bool sucesso = executarLote(g, FICHEIRO_CONSULTAS_VERIFICACAO, FICHEIRO_RESULTADOS_VERIFICACAO, NULL);
+    *tempoOtimizado = tempoAtual() - inicio;
+
+    long tamanhoLote = 0;
+    char *lote = sucesso ? lerFicheiro(FICHEIRO_RESULTADOS_VERIFICACAO, &tamanhoLote) : NULL;
+
+    long tamanhoIsoladas = 0;
+    bool iguais = lote != NULL;
+
+    for (int i = 0; i < CONSULTAS_LOTE && iguais; i++) {
+
+        f = fopen(FICHEIRO_CONSULTAS_VERIFICACAO, "w");
+        if (!f) {
+            iguais = false;
+            break;
+        }
+        for (int k = 1; k < linha[i]; k++) fputc('\n', f);
+        fprintf(f, "%s\n", consultas[i]);
+        fclose(f);
+
+        inicio = tempoAtual();
+        sucesso = executarLote(g, FICHEIRO_CONSULTAS_VERIFICACAO, FICHEIRO_RESULTADOS_VERIFICACAO, NULL);
+        *tempoReferencia += tempoAtual() - inicio;
+
+        long tamanho = 0;
+        char *resposta = sucesso ? lerFicheiro(FICHEIRO_RESULTADOS_VERIFICACAO, &tamanho) : NULL;
+        iguais = resposta && tamanhoIsoladas + tamanho <= tamanhoLote &&
+                 memcmp(lote + tamanhoIsoladas, resposta, tamanho) == 0;
+        tamanhoIsoladas += tamanho;
+        free(resposta);
+
+    }
+    iguais = iguais && tamanhoIsoladas == tamanhoLote;
+
+    free(lote);
+    libertarGrafoCSR(g);
+    remove(FICHEIRO_CONSULTAS_VERIFICACAO);
+    remove(FICHEIRO_RESULTADOS_VERIFICACAO);
+
+    return iguais;
+
+}
+
+/** Verificações isoladas, executadas uma vez por caso depois dos motores. */
+static const Verificacao verificacoes[] = {
+    { "densidade (grelha)", verificarDensidade },
+    { "ligacoes (visiveis)", verificarVisiveis },
+    { "ligacoes (raio)", verificarRaio },
+    { "vizinhas (k-d)", verificarArvoreKD },
+    { "regioes (baldes)", verificarRegioes },
+    { "remocao (vertices)", verificarRemocao },
+    { "ligacoes (em lote)", verificarLigacoesLote },
+    { "fecho (bits)", verificarFecho },
+    { "analise (diametro)", verificarAnalise },
+    { "frequencias (dic.)", verificarFrequencias },
+    { "lote (uma a uma)", verificarLote },
+};
+
+/** Número de entradas de `verificacoes`. */
+#define NUM_VERIFICACOES ((int)(sizeof(verificacoes) / sizeof(verificacoes[0])))
+
+/**
+ * @brief Regista o resultado de uma comparação e descreve as primeiras divergências.
+ *
+ * @param r Totais do par verificado.
+ * @param nome Nome do par verificado.
+ * @param iguais Resultado da comparação.
+ * @param semente Semente do caso.
+ * @param tempoReferencia Tempo da referência neste caso.
+ * @param tempoOtimizado Tempo da versão otimizada neste caso.
+ * @param descritas Número de divergências já descritas (atualizado).
+ */
+
+static void registarResultado(ResultadoMotor *r, const char *nome, bool iguais, unsigned int semente,
+                              double tempoReferencia, double tempoOtimizado, int *descritas) {
+
+    r -> casos++;
+    r -> tempoReferencia += tempoReferencia;
+    r -> tempoOtimizado += tempoOtimizado;
+
+    if (!iguais) {
+        r -> divergencias++;
+        if (*descritas < MAX_DIVERGENCIAS_DESCRITAS) {
+            printf("DIVERGENCIA: %s com a semente %u\n", nome, semente);
+            (*descritas)++;
+        }
+    }
+
+}
+
+/**
+ * @brief Regista o resultado de um dos motores comparados diretamente em `verificarMotores`.
+ *
+ * @param r Totais do par verificado.
+ * @param motor Par verificado.
+ * @param iguais Resultado da comparação.
+ * @param semente Semente do caso.
+ * @param tempoReferencia Tempo da referência neste caso.
+ * @param tempoOtimizado Tempo da versão otimizada neste caso.
+ * @param descritas Número de divergências já descritas (atualizado).
+ */
+
+static void registarComparacao(ResultadoMotor *r, Motor motor, bool iguais, unsigned int semente,
+                               double tempoReferencia, double tempoOtimizado, int *descritas) {
+
+    registarResultado(r, nomesMotores[motor], iguais, semente, tempoReferencia, tempoOtimizado, descritas);
+
+}
+
+/**
+ * @brief Imprime a linha do relatório de um par verificado.
+ *
+ * @param r Totais do par verificado.
+ * @param nome Nome do par verificado.
+ * @return Número de divergências do par.
+ */
+
+static long imprimirResultado(const ResultadoMotor *r, const char *nome) {
+
+    char razao[32] = "-";
+    if (r -> tempoOtimizado > 0) snprintf(razao, sizeof(razao), "%.1fx", r -> tempoReferencia / r -> tempoOtimizado);
+
+    printf("| %-20s | %6ld | %6ld | %10.4f | %10.4f | %8s |\n", nome,
+           r -> casos, r -> divergencias, r -> tempoReferencia, r -> tempoOtimizado, razao);
+
+    return r -> divergencias;
+
+}
+
+/**
+ * @brief Executa a verificação diferencial em vários mapas e grafos gerados.
+ *
+ * Cada caso usa um mapa até 48 x 48 para os locais nefastos e um grafo até 40
+ * vértices para as procuras; as procuras partem de um vértice ao acaso e os
+ * caminhos só são verificados em grafos até 16 vértices. As verificações da
+ * tabela `verificacoes` recebem os mesmos parâmetros sorteados.
+ *
+ * @param numCasos Número de casos a gerar.
+ * @param semente Semente inicial (o caso i usa semente + i).
+ * @param pool Conjunto de threads das versões paralelas.
+ * @return true se não houve nenhuma divergência.
+ */
+
+bool verificarMotores(int numCasos, unsigned int semente, PoolTarefas *pool) {
+
+    ResultadoMotor resultados[NUM_MOTORES], isoladas[NUM_VERIFICACOES];
+    memset(resultados, 0, sizeof(resultados));
+    memset(isoladas, 0, sizeof(isoladas));
+    int descritas = 0;
+
+    for (int caso = 0; caso < numCasos; caso++) {
+
+        CasoVerificacao atual = sortearCaso(semente + (unsigned int)caso);
+        unsigned int s = atual.semente, sorteio = atual.sorteio;
+
+        // Locais nefastos
+        Antena *lista = gerarAntenas(atual.mapa);
+
+        double inicio = tempoAtual();
+        Coordenada *referencia = detectarLocaisNefastos(lista);
+        double tempoReferencia = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        Coordenada *otimizado = detectarLocaisNefastosParalelo(lista, pool);
+        double tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_NEFASTOS], MOTOR_NEFASTOS,
+                           mesmosConjuntos(conjuntoLista(referencia, false), conjuntoLista(otimizado, false)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+        libertarCoordenadas(otimizado);
+
+        inicio = tempoAtual();
+        MapaCompacto *compacto = construirMapaCompacto(lista, atual.mapa.linhas, atual.mapa.colunas);
+        otimizado = detectarNefastosCompacto(compacto, pool);
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_NEFASTOS_COMPACTO], MOTOR_NEFASTOS_COMPACTO,
+                           compacto && mesmosConjuntos(conjuntoLista(referencia, false), conjuntoLista(otimizado, false)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+        libertarMapaCompacto(compacto);
+        libertarCoordenadas(otimizado);
+
+        inicio = tempoAtual();
+        IndiceInterferencia *indice = construirIndiceInterferencia(lista);
+        otimizado = locaisInterferencia(indice);
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_INTERFERENCIA], MOTOR_INTERFERENCIA,
+                           indice && mesmosConjuntos(conjuntoLista(referencia, false), conjuntoLista(otimizado, false)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+
+        libertarIndiceInterferencia(indice);
+
+        // A lista de referência não tem repetidos: ordenada, tem de coincidir com o conjunto
+        inicio = tempoAtual();
+        ConjuntoPosicoes ordenadoQsort = conjuntoLista(referencia, false);
+        tempoReferencia = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        referencia = ordenarCoordenadas(referencia);
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_ORDENACAO], MOTOR_ORDENACAO,
+                           mesmosConjuntos(ordenadoQsort, sequenciaLista(referencia)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+
+        libertarCoordenadas(referencia);
+        libertarCoordenadas(otimizado);
+        libertarAntenas(lista);
+
+        // Verificações isoladas: cada uma gera os seus dados a partir do caso
+        for (int v = 0; v < NUM_VERIFICACOES; v++) {
+            bool iguais = verificacoes[v].verificar(&atual, &tempoReferencia, &tempoOtimizado);
+            registarResultado(&isoladas[v], verificacoes[v].nome, iguais, s, tempoReferencia, tempoOtimizado, &descritas);
+        }
+
+        // Procuras sobre um grafo pequeno
+        Vertice *grafo = gerarGrafoCaso(&atual);
+        GrafoCSR *g = construirGrafoCSR(grafo);
+        if (!grafo || !g) {
+            libertarGrafoCSR(g);
+            libertarGrafo(grafo);
+            continue;
+        }
+
+        int origem = (int)((sorteio >> 4) % (unsigned)g -> numVertices);
+        int ox = g -> x[origem], oy = g -> y[origem];
+
+        inicio = tempoAtual();
+        referencia = procuraLargura(grafo, ox, oy);
+        tempoReferencia = tempoAtual() - inicio;
+
+        inicio = tempoAtual();
+        DistanciasLargura *d = procuraLarguraParalela(g, origem, pool);
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_LARGURA_PARALELA], MOTOR_LARGURA_PARALELA,
+                           mesmosConjuntos(conjuntoLista(referencia, false), conjuntoDistancias(g, d, 0)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+        libertarDistanciasLargura(d);
+
+        inicio = tempoAtual();
+        d = procuraLarguraMultipla(g, &origem, 1);
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_LARGURA_MULTIPLA], MOTOR_LARGURA_MULTIPLA,
+                           mesmosConjuntos(conjuntoLista(referencia, false), conjuntoDistancias(g, d, 0)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+        libertarDistanciasLargura(d);
+
+        // A origem é procurada pelas coordenadas, o que exercita a permutação (x, y)
+        GrafoCSR *h = reordenarGrafoCSR(g);
+        int origemH = indiceVerticeCSR(h, ox, oy);
+        inicio = tempoAtual();
+        d = origemH >= 0 ? procuraLarguraMultipla(h, &origemH, 1) : NULL;
+        tempoOtimizado = tempoAtual() - inicio;
+
+        registarComparacao(&resultados[MOTOR_LARGURA_HILBERT], MOTOR_LARGURA_HILBERT,
+                           d && mesmosConjuntos(conjuntoLista(referencia, false), conjuntoDistancias(h, d, 0)),
+                           s, tempoReferencia, tempoOtimizado, &descritas);
+        libertarDistanciasLargura(d);
+        libertarGrafoCSR(h);
+        libertarCoordenadas(referencia);
+
+        // A referência da procura em profundidade é exponencial em grafos com ciclos
+        if (g -> numVertices <= 24) {
+
+            inicio = tempoAtual();
+            referencia = procuraProfundidade(grafo, ox, oy);
+            tempoReferencia = tempoAtual() - inicio;
+
+            inicio = tempoAtual();
+            otimizado = procuraProfundidadeCSR(g, origem);
+            tempoOtimizado = tempoAtual() - inicio;
+
+            registarComparacao(&resultados[MOTOR_PROFUNDIDADE], MOTOR_PROFUNDIDADE,
+                               mesmosConjuntos(conjuntoLista(referencia, false), conjuntoLista(otimizado, false)),
+                               s, tempoReferencia, tempoOtimizado, &descritas);
+
+            libertarCoordenadas(referencia);
+            libertarCoordenadas(otimizado);
+
+        }
+
+        if (g -> numVertices <= 16) {
+
+            int destino = (int)((sorteio >> 9) % (unsigned)g -> numVertices);
+            int dx = g -> x[destino], dy = g -> y[destino];
+
+            inicio = tempoAtual();
+            referencia = caminhosEntreAntenas(grafo, ox, oy, dx, dy);
+            tempoReferencia = tempoAtual() - inicio;
+
+            LimitesCaminhos limites = { 0, 0, 0 };
+            inicio = tempoAtual();
+            ListaCaminhos *l = caminhosEntreAntenasParalelo(g, pool, ox, oy, dx, dy, limites);
+            tempoOtimizado = tempoAtual() - inicio;
+
+            registarComparacao(&resultados[MOTOR_CAMINHOS], MOTOR_CAMINHOS,
+                               mesmosConjuntos(conjuntoLista(referencia, true), conjuntoCaminhos(g, l)),
+                               s, tempoReferencia, tempoOtimizado, &descritas);
+
+            // Limite igual ao número real de caminhos (completo) e um abaixo (parcial)
+            if (l && !l -> parcial && l -> numCaminhos > 0) {
+
+                limites.maxCaminhos = l -> numCaminhos;
+                inicio = tempoAtual();
+                ListaCaminhos *exato = caminhosEntreAntenasParalelo(g, pool, ox, oy, dx, dy, limites);
+                tempoOtimizado = tempoAtual() - inicio;
+
+                limites.maxCaminhos = l -> numCaminhos - 1;
+                ListaCaminhos *curto = limites.maxCaminhos > 0 ?
+                                       caminhosEntreAntenasParalelo(g, pool, ox, oy, dx, dy, limites) : NULL;
+
+                bool iguais = exato && !exato -> parcial && exato -> numCaminhos == l -> numCaminhos &&
+                              (limites.maxCaminhos == 0 ||
+                               (curto && curto -> parcial && curto -> numCaminhos == limites.maxCaminhos));
+                registarComparacao(&resultados[MOTOR_CAMINHOS_LIMITE], MOTOR_CAMINHOS_LIMITE,
+                                   iguais, s, tempoReferencia, tempoOtimizado, &descritas);
+
+                libertarListaCaminhos(exato);
+                libertarListaCaminhos(curto);
+
+            }
+
+            libertarCoordenadas(referencia);
+            libertarListaCaminhos(l);
+
+        }
+
+        libertarGrafoCSR(g);
+        libertarGrafo(grafo);
+
+    }
+
+    long total = 0;
+    printf("\n============================================================================\n");
+    printf(" VERIFICACAO DIFERENCIAL (%d casos, semente %u)\n", numCasos, semente);
+    printf("============================================================================\n");
+    printf("| %-20s | %6s | %6s | %10s | %10s | %8s |\n", "MOTOR", "CASOS", "DIVERG", "REF (s)", "OTIM (s)", "RAZAO");
+    printf("============================================================================\n");
+
+    for (int m = 0; m < NUM_MOTORES; m++) total += imprimirResultado(&resultados[m], nomesMotores[m]);
+    for (int v = 0; v < NUM_VERIFICACOES; v++) total += imprimirResultado(&isoladas[v], verificacoes[v].nome);
+
+    printf("============================================================================\n");
+    printf("%s\n", total == 0 ? "Sem divergências." : "Foram encontradas divergências.");
+
+    return total == 0;
+
+}
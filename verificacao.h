@@ -0,0 +1,28 @@
+/**
+ * ╔══════════════════════════════════════════════╗
+ * ║   Projeto | Estruturas de Dados Avançadas    ║
+ * ║   Código desenvolvido por Thiago Abreu       ║
+ * ║   EST-IPCA, Barcelos — 2025                  ║
+ * ╚══════════════════════════════════════════════╝
+ */
+
+/**
+ * @file verificacao.h
+ * @author Thiago Abreu
+ * @brief Verificação diferencial das versões otimizadas contra as de referência.
+ *
+ * As funções originais sobre listas ligadas (`detectarLocaisNefastos`,
+ * `procuraLargura`, `procuraProfundidade` e `caminhosEntreAntenas`) são a
+ * referência; as versões otimizadas são executadas sobre os mesmos mapas
+ * gerados e os resultados comparados como conjuntos de coordenadas.
+ */
+
+#ifndef VERIFICACAO_H
+#define VERIFICACAO_H
+
+#include <stdbool.h>
+#include "tarefas.h"
+
+bool verificarMotores(int numCasos, unsigned int semente, PoolTarefas *pool);
+
+#endif